@@ -143,7 +143,7 @@ function(bsoncxx_add_library TARGET OUTPUT_NAME LINK_TYPE)
         target_compile_definitions(${TARGET} PUBLIC BSONCXX_STATIC)
     endif()
 
-    target_link_libraries(${TARGET} PRIVATE ${bson_target})
+    target_link_libraries(${TARGET} PRIVATE ${bson_target} Threads::Threads)
     target_include_directories(
         ${TARGET}
         PUBLIC
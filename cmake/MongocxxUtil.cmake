@@ -98,7 +98,7 @@ function(mongocxx_add_library TARGET OUTPUT_NAME LINK_TYPE)
         target_compile_definitions(${TARGET} PUBLIC MONGOCXX_STATIC)
     endif()
 
-    target_link_libraries(${TARGET} PRIVATE ${mongoc_target})
+    target_link_libraries(${TARGET} PRIVATE ${mongoc_target} Threads::Threads)
     target_include_directories(
         ${TARGET}
         PUBLIC
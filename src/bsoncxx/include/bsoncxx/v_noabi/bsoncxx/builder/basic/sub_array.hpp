@@ -16,6 +16,16 @@
 
 #include <bsoncxx/builder/basic/sub_array-fwd.hpp>
 
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <bsoncxx/vector/accessor-fwd.hpp>
+#include <bsoncxx/vector/detail-fwd.hpp>
+#include <bsoncxx/vector/formats-fwd.hpp>
+
 #include <bsoncxx/builder/basic/helpers.hpp>
 #include <bsoncxx/builder/concatenate.hpp>
 #include <bsoncxx/builder/core.hpp>
@@ -62,6 +72,36 @@ class sub_array {
     ///
     void append() {}
 
+    /// @brief Append BSON Binary Vectors of the same format and number of elements as consecutive array elements.
+    /// @param fmt Instance of a format type from @ref bsoncxx::v_noabi::vector::formats
+    /// @param element_count Number of elements of every vector.
+    /// @param vector_count Number of vectors to append.
+    /// @return One writable vector::accessor per appended vector, in order. The accessors are valid until the next
+    /// modification of the builder. Every element must be overwritten before that element is read or the resulting
+    /// document is used.
+    /// @throws bsoncxx::v_noabi::exception if the vectors fail to append due to the BSON size limit.
+    /// @throws bsoncxx::v_noabi::exception if a vector of the requested size would be too large to represent.
+    ///
+    /// The binary length is computed once and the space for all of the vectors is reserved at once, which avoids the
+    /// per-element overhead of appending each vector with @ref bsoncxx::v_noabi::builder::basic::sub_binary.
+    template <typename Format, typename SFINAE = typename vector::detail::format_traits<Format>::value_type>
+    std::vector<vector::accessor<Format>>
+    append_vectors(Format fmt, std::size_t element_count, std::size_t vector_count) {
+        (void)fmt;
+        std::uint32_t binary_data_length = Format::length_for_append(element_count);
+        std::vector<std::uint8_t*> binary_data(vector_count);
+        _core->append(binary_sub_type::k_vector, binary_data_length, vector_count, binary_data.data());
+
+        std::vector<vector::accessor<Format>> vectors;
+        vectors.reserve(vector_count);
+        for (std::uint8_t* data : binary_data) {
+            Format::write_frame(data, binary_data_length, element_count);
+            vectors.push_back(
+                vector::accessor<Format>{vector::detail::accessor_data<Format>(data, binary_data_length)});
+        }
+        return vectors;
+    }
+
    private:
     //
     // Appends a BSON value.
@@ -251,6 +251,32 @@ class core {
     ///
     BSONCXX_ABI_EXPORT_CDECL(uint8_t*) append(binary_sub_type sub_type, uint32_t length);
 
+    ///
+    /// Appends BSON binary data of the same subtype and length as consecutive elements of the
+    /// current array, allocating space for all of them at once.
+    ///
+    /// The array grows once to hold every element, and the element headers are written in place.
+    ///
+    /// @param sub_type
+    ///   The subtype of every binary datum.
+    /// @param length
+    ///   The length of every binary datum.
+    /// @param count
+    ///   The number of binary data to append.
+    /// @param binary_data
+    ///   An array of `count` pointers. On return, `binary_data[i]` points to the allocated data block
+    ///   of the i-th binary datum. The pointers are invalidated by the next modification of the
+    ///   builder. The caller must write to every byte or discard the builder.
+    ///
+    /// @throws
+    ///   bsoncxx::v_noabi::exception if the current BSON datum is not an array.
+    ///   bsoncxx::v_noabi::exception if the subtype is binary_sub_type::k_binary_deprecated.
+    ///   bsoncxx::v_noabi::exception if the binary data fail to append. No element is appended
+    ///   then.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(void)
+    append(binary_sub_type sub_type, uint32_t length, std::size_t count, uint8_t** binary_data);
+
     ///
     /// Appends a BSON undefined.
     ///
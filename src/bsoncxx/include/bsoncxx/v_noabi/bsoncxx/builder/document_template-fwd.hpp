@@ -0,0 +1,51 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <bsoncxx/config/prelude.hpp>
+
+namespace bsoncxx {
+namespace v_noabi {
+namespace builder {
+
+template <typename T>
+class slot;
+
+template <typename... Slots>
+class nested_slots;
+
+template <typename... Slots>
+class document_template;
+
+} // namespace builder
+} // namespace v_noabi
+} // namespace bsoncxx
+
+namespace bsoncxx {
+namespace builder {
+
+using ::bsoncxx::v_noabi::builder::document_template;
+using ::bsoncxx::v_noabi::builder::nested_slots;
+using ::bsoncxx::v_noabi::builder::slot;
+
+} // namespace builder
+} // namespace bsoncxx
+
+#include <bsoncxx/config/postlude.hpp>
+
+///
+/// @file
+/// Declares entities for building documents of a fixed shape from a preformatted template.
+///
@@ -0,0 +1,661 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/builder/document_template-fwd.hpp>
+
+#include <bsoncxx/decimal128.hpp>
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/oid.hpp>
+#include <bsoncxx/stdx/string_view.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <bsoncxx/config/prelude.hpp>
+
+namespace bsoncxx {
+namespace v_noabi {
+namespace builder {
+
+namespace detail {
+
+inline void store_le32(std::uint8_t* p, std::uint32_t v) {
+    p[0] = static_cast<std::uint8_t>(v);
+    p[1] = static_cast<std::uint8_t>(v >> 8u);
+    p[2] = static_cast<std::uint8_t>(v >> 16u);
+    p[3] = static_cast<std::uint8_t>(v >> 24u);
+}
+
+inline void store_le64(std::uint8_t* p, std::uint64_t v) {
+    store_le32(p, static_cast<std::uint32_t>(v));
+    store_le32(p + 4, static_cast<std::uint32_t>(v >> 32u));
+}
+
+inline std::uint32_t load_le32(std::uint8_t const* p) {
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8u) |
+           (static_cast<std::uint32_t>(p[2]) << 16u) | (static_cast<std::uint32_t>(p[3]) << 24u);
+}
+
+inline void BSONCXX_ABI_CDECL delete_template_bytes(std::uint8_t* ptr) {
+    delete[] ptr;
+}
+
+// The encoding of a value of type T in a slot. Fixed-size values are stored in place of their
+// placeholder. store() returns the number of bytes written.
+template <typename T>
+struct slot_traits;
+
+template <>
+struct slot_traits<double> {
+    static constexpr type id() {
+        return type::k_double;
+    }
+
+    static constexpr std::size_t size() {
+        return 8u;
+    }
+
+    static std::size_t store(std::uint8_t* p, double v) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        store_le64(p, bits);
+        return size();
+    }
+};
+
+template <>
+struct slot_traits<stdx::string_view> {
+    static constexpr type id() {
+        return type::k_string;
+    }
+
+    // The placeholder is an empty string: its length prefix and null terminator.
+    static constexpr std::size_t size() {
+        return 5u;
+    }
+
+    static std::size_t store(std::uint8_t* p, stdx::string_view v) {
+        store_le32(p, static_cast<std::uint32_t>(v.size() + 1u));
+        if (!v.empty()) {
+            std::memcpy(p + 4, v.data(), v.size());
+        }
+        p[4u + v.size()] = 0u;
+        return size() + v.size();
+    }
+};
+
+template <>
+struct slot_traits<oid> {
+    static constexpr type id() {
+        return type::k_oid;
+    }
+
+    static constexpr std::size_t size() {
+        return 12u;
+    }
+
+    static std::size_t store(std::uint8_t* p, oid const& v) {
+        std::memcpy(p, v.bytes(), size());
+        return size();
+    }
+};
+
+template <>
+struct slot_traits<bool> {
+    static constexpr type id() {
+        return type::k_bool;
+    }
+
+    static constexpr std::size_t size() {
+        return 1u;
+    }
+
+    static std::size_t store(std::uint8_t* p, bool v) {
+        p[0] = v ? 1u : 0u;
+        return size();
+    }
+};
+
+template <>
+struct slot_traits<types::b_date> {
+    static constexpr type id() {
+        return type::k_date;
+    }
+
+    static constexpr std::size_t size() {
+        return 8u;
+    }
+
+    static std::size_t store(std::uint8_t* p, types::b_date const& v) {
+        store_le64(p, static_cast<std::uint64_t>(v.to_int64()));
+        return size();
+    }
+};
+
+template <>
+struct slot_traits<std::int32_t> {
+    static constexpr type id() {
+        return type::k_int32;
+    }
+
+    static constexpr std::size_t size() {
+        return 4u;
+    }
+
+    static std::size_t store(std::uint8_t* p, std::int32_t v) {
+        store_le32(p, static_cast<std::uint32_t>(v));
+        return size();
+    }
+};
+
+template <>
+struct slot_traits<types::b_timestamp> {
+    static constexpr type id() {
+        return type::k_timestamp;
+    }
+
+    static constexpr std::size_t size() {
+        return 8u;
+    }
+
+    static std::size_t store(std::uint8_t* p, types::b_timestamp const& v) {
+        store_le32(p, v.increment);
+        store_le32(p + 4, v.timestamp);
+        return size();
+    }
+};
+
+template <>
+struct slot_traits<std::int64_t> {
+    static constexpr type id() {
+        return type::k_int64;
+    }
+
+    static constexpr std::size_t size() {
+        return 8u;
+    }
+
+    static std::size_t store(std::uint8_t* p, std::int64_t v) {
+        store_le64(p, static_cast<std::uint64_t>(v));
+        return size();
+    }
+};
+
+template <>
+struct slot_traits<decimal128> {
+    static constexpr type id() {
+        return type::k_decimal128;
+    }
+
+    static constexpr std::size_t size() {
+        return 16u;
+    }
+
+    static std::size_t store(std::uint8_t* p, decimal128 const& v) {
+        store_le64(p, v.low());
+        store_le64(p + 8, v.high());
+        return size();
+    }
+};
+
+// Placeholders are zero-filled, except for strings which require a length prefix.
+template <typename T>
+void store_placeholder(slot_traits<T>, std::uint8_t*) {}
+
+inline void store_placeholder(slot_traits<stdx::string_view>, std::uint8_t* p) {
+    store_le32(p, 1u);
+}
+
+template <typename T>
+struct is_variable_slot : std::is_same<T, stdx::string_view> {};
+
+template <typename... Ts>
+struct type_list {};
+
+template <typename... Lists>
+struct concat;
+
+template <>
+struct concat<> {
+    using type = type_list<>;
+};
+
+template <typename... As>
+struct concat<type_list<As...>> {
+    using type = type_list<As...>;
+};
+
+template <typename... As, typename... Bs, typename... Rest>
+struct concat<type_list<As...>, type_list<Bs...>, Rest...> {
+    using type = typename concat<type_list<As..., Bs...>, Rest...>::type;
+};
+
+// The types of the values of a slot, in document order.
+template <typename Slot>
+struct slot_values;
+
+template <typename T>
+struct slot_values<slot<T>> {
+    using type = type_list<T>;
+};
+
+template <typename... Slots>
+struct slot_values<nested_slots<Slots...>> {
+    using type = typename concat<typename slot_values<Slots>::type...>::type;
+};
+
+template <typename List>
+struct any_variable;
+
+template <>
+struct any_variable<type_list<>> : std::false_type {};
+
+template <typename T, typename... Ts>
+struct any_variable<type_list<T, Ts...>>
+    : std::integral_constant<bool, is_variable_slot<T>::value || any_variable<type_list<Ts...>>::value> {};
+
+template <typename List>
+struct as_tuple;
+
+template <typename... Ts>
+struct as_tuple<type_list<Ts...>> {
+    using type = std::tuple<Ts...>;
+};
+
+// The preformatted bytes of a document with a placeholder value in every slot.
+class template_image {
+   public:
+    struct slot_info {
+        // Offset of the placeholder value.
+        std::size_t offset;
+    };
+
+    struct document_info {
+        // Offset of the length prefix.
+        std::size_t offset;
+
+        // The range of slots contained by the document.
+        std::size_t first_slot;
+        std::size_t last_slot;
+    };
+
+    template <typename... Slots>
+    explicit template_image(Slots const&... slots) {
+        _documents.push_back(document_info{0u, 0u, 0u});
+        _bytes.resize(4u);
+
+        int const expand[] = {0, (this->append(slots), 0)...};
+        (void)expand;
+
+        _bytes.push_back(0u);
+        _documents.front().last_slot = _slots.size();
+        store_le32(_bytes.data(), static_cast<std::uint32_t>(_bytes.size()));
+    }
+
+    std::vector<std::uint8_t> const& bytes() const {
+        return _bytes;
+    }
+
+    std::vector<slot_info> const& slots() const {
+        return _slots;
+    }
+
+    std::vector<document_info> const& documents() const {
+        return _documents;
+    }
+
+   private:
+    void append_key(type id, stdx::string_view key) {
+        _bytes.push_back(static_cast<std::uint8_t>(id));
+        _bytes.insert(_bytes.end(), key.begin(), key.end());
+        _bytes.push_back(0u);
+    }
+
+    template <typename T>
+    void append(slot<T> const& s) {
+        append_key(slot_traits<T>::id(), s.key());
+        _slots.push_back(slot_info{_bytes.size()});
+
+        auto const offset = _bytes.size();
+        _bytes.resize(offset + slot_traits<T>::size());
+        store_placeholder(slot_traits<T>{}, _bytes.data() + offset);
+    }
+
+    template <typename... Slots>
+    void append(nested_slots<Slots...> const& n) {
+        append_key(type::k_document, n.key());
+
+        auto const& image = n.image();
+        auto const base = _bytes.size();
+        auto const slot_base = _slots.size();
+
+        for (auto const& s : image._slots) {
+            _slots.push_back(slot_info{base + s.offset});
+        }
+
+        for (auto const& d : image._documents) {
+            _documents.push_back(document_info{base + d.offset, slot_base + d.first_slot, slot_base + d.last_slot});
+        }
+
+        _bytes.insert(_bytes.end(), image._bytes.begin(), image._bytes.end());
+    }
+
+    std::vector<std::uint8_t> _bytes;
+    std::vector<slot_info> _slots;
+    std::vector<document_info> _documents;
+};
+
+} // namespace detail
+
+///
+/// A value of type T at a fixed key of a bsoncxx::v_noabi::builder::document_template.
+///
+/// T must be one of `double`, `bsoncxx::v_noabi::stdx::string_view`, `bsoncxx::v_noabi::oid`,
+/// `bool`, `bsoncxx::v_noabi::types::b_date`, `std::int32_t`,
+/// `bsoncxx::v_noabi::types::b_timestamp`, `std::int64_t`, or `bsoncxx::v_noabi::decimal128`.
+///
+template <typename T>
+class slot {
+   public:
+    using value_type = T;
+
+    ///
+    /// @param key
+    ///     The key of the value. Must not contain a null byte.
+    ///
+    explicit slot(stdx::string_view key) : _key(key) {}
+
+    ///
+    /// The key of the value.
+    ///
+    stdx::string_view key() const {
+        return _key;
+    }
+
+   private:
+    stdx::string_view _key;
+};
+
+///
+/// A subdocument of a fixed shape at a fixed key of a bsoncxx::v_noabi::builder::document_template.
+///
+/// @see
+/// - @ref bsoncxx::v_noabi::builder::nest
+///
+template <typename... Slots>
+class nested_slots {
+   public:
+    ///
+    /// @param key
+    ///     The key of the subdocument. Must not contain a null byte.
+    /// @param slots
+    ///     The slots of the subdocument, in order.
+    ///
+    explicit nested_slots(stdx::string_view key, Slots const&... slots) : _key(key), _image(slots...) {}
+
+    ///
+    /// The key of the subdocument.
+    ///
+    stdx::string_view key() const {
+        return _key;
+    }
+
+   private:
+    friend detail::template_image;
+
+    detail::template_image const& image() const {
+        return _image;
+    }
+
+    stdx::string_view _key;
+    detail::template_image _image;
+};
+
+///
+/// Creates a subdocument of a fixed shape for use in a bsoncxx::v_noabi::builder::document_template.
+///
+/// @param key
+///     The key of the subdocument. Must not contain a null byte.
+/// @param slots
+///     The slots of the subdocument, in order.
+///
+template <typename... Slots>
+nested_slots<Slots...> nest(stdx::string_view key, Slots const&... slots) {
+    return nested_slots<Slots...>{key, slots...};
+}
+
+///
+/// Builds documents of a fixed shape from a preformatted template.
+///
+/// The keys, type tags and placeholder values of every slot are encoded once, when the template is
+/// constructed. Building a document then copies the preformatted bytes and stores each value at the
+/// precomputed offset of its slot. When every slot has a fixed-size type, this is a single
+/// allocation, a single `memcpy`, and one store per value. String slots additionally shift the
+/// bytes which follow them and update the length of the enclosing documents.
+///
+/// For example, the filter `{_id: ?, tenant: ?, v: {$gt: ?}}`:
+/// @code{.cpp}
+/// static auto const filter = bsoncxx::builder::make_document_template(
+///     bsoncxx::builder::slot<std::int64_t>{"_id"},
+///     bsoncxx::builder::slot<bsoncxx::stdx::string_view>{"tenant"},
+///     bsoncxx::builder::nest("v", bsoncxx::builder::slot<std::int32_t>{"$gt"}));
+///
+/// auto doc = filter.build(std::int64_t{42}, "acme", 7);
+/// @endcode
+///
+/// The layout of the template (the number and types of its values, and whether it has
+/// variable-size values) is known at compile time. The byte offsets depend on the keys and are
+/// computed at construction, so a template is typically constructed once and reused.
+///
+template <typename... Slots>
+class document_template {
+    using value_types = typename detail::concat<typename detail::slot_values<Slots>::type...>::type;
+    using tuple_type = typename detail::as_tuple<value_types>::type;
+
+   public:
+    ///
+    /// The number of values of a document, i.e. the number of slots including those of nested
+    /// subdocuments.
+    ///
+    static constexpr std::size_t size() {
+        return std::tuple_size<tuple_type>::value;
+    }
+
+    ///
+    /// Encodes the template.
+    ///
+    /// @param slots
+    ///     The slots of the document, in order.
+    ///
+    explicit document_template(Slots const&... slots) : _image(slots...) {}
+
+    ///
+    /// Builds a document from the template.
+    ///
+    /// @param values
+    ///     One value per slot, in document order, each convertible to the type of its slot.
+    ///
+    /// @return
+    ///     The document.
+    ///
+    template <typename... Args>
+    document::value build(Args&&... values) const {
+        static_assert(sizeof...(Args) == size(), "build() requires exactly one value per slot");
+
+        tuple_type const converted(std::forward<Args>(values)...);
+
+        return build_tuple(converted, detail::any_variable<value_types>{});
+    }
+
+    ///
+    /// A view of the template itself, with a placeholder value (zero, false, or an empty string)
+    /// in every slot.
+    ///
+    document::view view() const {
+        return document::view{_image.bytes().data(), _image.bytes().size()};
+    }
+
+   private:
+    using slot_info = detail::template_image::slot_info;
+
+    static document::value::unique_ptr_type allocate(std::size_t length) {
+        return document::value::unique_ptr_type{new std::uint8_t[length], &detail::delete_template_bytes};
+    }
+
+    // Fixed-size values only: the output has the same layout as the template.
+    document::value build_tuple(tuple_type const& values, std::false_type) const {
+        auto const& bytes = _image.bytes();
+        auto data = allocate(bytes.size());
+
+        std::memcpy(data.get(), bytes.data(), bytes.size());
+        store_fixed<0u>(data.get(), _image.slots().data(), values);
+
+        return document::value{std::move(data), bytes.size()};
+    }
+
+    template <std::size_t I>
+    static typename std::enable_if<(I == size())>::type store_fixed(std::uint8_t*, slot_info const*, tuple_type const&) {}
+
+    template <std::size_t I>
+    static typename std::enable_if<(I < size())>::type
+    store_fixed(std::uint8_t* data, slot_info const* slots, tuple_type const& values) {
+        using T = typename std::tuple_element<I, tuple_type>::type;
+
+        detail::slot_traits<T>::store(data + slots[I].offset, std::get<I>(values));
+        store_fixed<I + 1u>(data, slots, values);
+    }
+
+    // Variable-size values: copy the template between slots, then fix up the document lengths.
+    document::value build_tuple(tuple_type const& values, std::true_type) const {
+        std::size_t extra[size()];
+        collect_extra<0u>(extra, values);
+
+        auto const& bytes = _image.bytes();
+        auto const& slots = _image.slots();
+
+        std::size_t length = bytes.size();
+        for (auto const e : extra) {
+            length += e;
+        }
+
+        auto data = allocate(length);
+
+        std::size_t src = 0u;
+        std::size_t dst = 0u;
+        store_variable<0u>(data.get(), bytes.data(), slots.data(), src, dst, values);
+        std::memcpy(data.get() + dst, bytes.data() + src, bytes.size() - src);
+
+        for (auto const& d : _image.documents()) {
+            std::size_t shift = 0u;
+            for (std::size_t i = 0u; i < d.first_slot; ++i) {
+                shift += extra[i];
+            }
+
+            std::size_t growth = 0u;
+            for (std::size_t i = d.first_slot; i < d.last_slot; ++i) {
+                growth += extra[i];
+            }
+
+            auto const original = detail::load_le32(bytes.data() + d.offset);
+            detail::store_le32(data.get() + d.offset + shift, original + static_cast<std::uint32_t>(growth));
+        }
+
+        return document::value{std::move(data), length};
+    }
+
+    template <std::size_t I>
+    static typename std::enable_if<(I == size())>::type collect_extra(std::size_t*, tuple_type const&) {}
+
+    template <std::size_t I>
+    static typename std::enable_if<(I < size())>::type collect_extra(std::size_t* extra, tuple_type const& values) {
+        extra[I] = extra_size(std::get<I>(values));
+        collect_extra<I + 1u>(extra, values);
+    }
+
+    template <typename T>
+    static std::size_t extra_size(T const&) {
+        return 0u;
+    }
+
+    static std::size_t extra_size(stdx::string_view v) {
+        return v.size();
+    }
+
+    template <std::size_t I>
+    static typename std::enable_if<(I == size())>::type
+    store_variable(std::uint8_t*, std::uint8_t const*, slot_info const*, std::size_t&, std::size_t&, tuple_type const&) {}
+
+    template <std::size_t I>
+    static typename std::enable_if<(I < size())>::type store_variable(
+        std::uint8_t* data,
+        std::uint8_t const* bytes,
+        slot_info const* slots,
+        std::size_t& src,
+        std::size_t& dst,
+        tuple_type const& values) {
+        using T = typename std::tuple_element<I, tuple_type>::type;
+
+        auto const offset = slots[I].offset;
+
+        std::memcpy(data + dst, bytes + src, offset - src);
+        dst += offset - src;
+
+        dst += detail::slot_traits<T>::store(data + dst, std::get<I>(values));
+        src = offset + detail::slot_traits<T>::size();
+
+        store_variable<I + 1u>(data, bytes, slots, src, dst, values);
+    }
+
+    detail::template_image _image;
+};
+
+///
+/// Creates a bsoncxx::v_noabi::builder::document_template.
+///
+/// @param slots
+///     The slots of the document, in order.
+///
+template <typename... Slots>
+document_template<Slots...> make_document_template(Slots const&... slots) {
+    return document_template<Slots...>{slots...};
+}
+
+} // namespace builder
+} // namespace v_noabi
+} // namespace bsoncxx
+
+namespace bsoncxx {
+namespace builder {
+
+using ::bsoncxx::v_noabi::builder::make_document_template;
+using ::bsoncxx::v_noabi::builder::nest;
+
+} // namespace builder
+} // namespace bsoncxx
+
+#include <bsoncxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref bsoncxx::v_noabi::builder::document_template.
+///
@@ -14,15 +14,25 @@
 
 #pragma once
 
-#include <sstream>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
 
 #include <bsoncxx/builder/basic/array-fwd.hpp>
 #include <bsoncxx/builder/list-fwd.hpp>
 
+#include <bsoncxx/array/view.hpp>
 #include <bsoncxx/builder/core.hpp>
+#include <bsoncxx/document/value.hpp>
 #include <bsoncxx/exception/error_code.hpp>
 #include <bsoncxx/exception/exception.hpp>
+#include <bsoncxx/stdx/optional.hpp>
+#include <bsoncxx/stdx/string_view.hpp>
+#include <bsoncxx/types.hpp>
 #include <bsoncxx/types/bson_value/value.hpp>
+#include <bsoncxx/types/bson_value/view.hpp>
 
 #include <bsoncxx/config/prelude.hpp>
 
@@ -33,6 +43,11 @@ namespace builder {
 ///
 /// A JSON-like builder for creating documents and arrays.
 ///
+/// A list constructed from an initializer list encodes its elements once, when it is constructed,
+/// into a single buffer. Nested lists are appended to their parent by copying their encoded bytes.
+/// Booleans, 32-bit and 64-bit integers, doubles and short strings constructed from character arrays
+/// are stored without allocating.
+///
 class list {
     using initializer_list_t = std::initializer_list<list>;
 
@@ -54,7 +69,42 @@ class list {
     /// - @ref bsoncxx::v_noabi::types::bson_value::value.
     ///
     template <typename T>
-    list(T value) : val{value} {}
+    list(T value) : owned{value}, val{owned->view()} {}
+
+    ///
+    /// Creates a bsoncxx::v_noabi::builder::list from a BSON boolean.
+    ///
+    list(bool value) : val{types::b_bool{value}} {}
+
+    ///
+    /// Creates a bsoncxx::v_noabi::builder::list from a BSON 32-bit integer.
+    ///
+    list(std::int32_t value) : val{types::b_int32{value}} {}
+
+    ///
+    /// Creates a bsoncxx::v_noabi::builder::list from a BSON 64-bit integer.
+    ///
+    list(std::int64_t value) : val{types::b_int64{value}} {}
+
+    ///
+    /// Creates a bsoncxx::v_noabi::builder::list from a BSON double.
+    ///
+    list(double value) : val{types::b_double{value}} {}
+
+    ///
+    /// Creates a bsoncxx::v_noabi::builder::list from a BSON UTF-8 string.
+    ///
+    /// The string is copied. Strings shorter than @ref k_inline_string_length bytes, e.g. most keys,
+    /// are stored in the list itself without allocating.
+    ///
+    /// @param value
+    ///     a character array, typically a string literal. The string ends at the first null
+    ///     character, or at the end of the array if there is none.
+    ///
+    template <std::size_t N>
+    list(char const (&value)[N]) {
+        assign_string(value, N);
+    }
 
     ///
     /// Creates a BSON document, if possible. Otherwise, it will create a BSON array. A document is
@@ -78,6 +128,40 @@ class list {
     ///
     list(initializer_list_t init) : list(init, true, true) {}
 
+    list(list const& other) : owned{other.owned}, encoded{other.encoded}, val{other.val} {
+        rebind(other);
+    }
+
+    list& operator=(list const& other) {
+        if (this != &other) {
+            owned = other.owned;
+            encoded = other.encoded;
+            val = other.val;
+            rebind(other);
+        }
+
+        return *this;
+    }
+
+    // Moving the owning members does not move the data they own, but a string stored in the list
+    // itself must be copied.
+    list(list&& other) : owned{std::move(other.owned)}, encoded{std::move(other.encoded)}, val{other.val} {
+        rebind(other);
+    }
+
+    list& operator=(list&& other) {
+        if (this != &other) {
+            owned = std::move(other.owned);
+            encoded = std::move(other.encoded);
+            val = other.val;
+            rebind(other);
+        }
+
+        return *this;
+    }
+
+    ~list() = default;
+
     ///
     /// Provides a view of the underlying BSON value.
     ///
@@ -95,51 +179,128 @@ class list {
     /// - @ref bsoncxx::v_noabi::types::bson_value::view.
     ///
     types::bson_value::view view() {
-        return val.view();
+        return val;
     }
 
+    ///
+    /// The size of the buffer in which a list stores a string constructed from a character array
+    /// without allocating.
+    ///
+    static constexpr std::size_t k_inline_string_length = 24;
+
    private:
-    types::bson_value::value val;
+    // Holds a string shorter than k_inline_string_length bytes constructed from a character array.
+    char inline_string[k_inline_string_length];
+
+    // Set when the value must be copied to be owned by this list.
+    stdx::optional<types::bson_value::value> owned;
+
+    // Set when constructed from an initializer list: the encoded document or array.
+    stdx::optional<bsoncxx::v_noabi::document::value> encoded;
+
+    // The value of this list, which may refer to `owned` or `encoded`.
+    types::bson_value::view val;
 
     friend ::bsoncxx::v_noabi::builder::document;
     friend ::bsoncxx::v_noabi::builder::array;
 
-    list(initializer_list_t init, bool type_deduction, bool is_array) : val{nullptr} {
-        std::stringstream err_msg{"cannot construct document"};
-        bool valid_document = false;
-        if (type_deduction || !is_array) {
-            valid_document = [&] {
-                if (init.size() % 2 != 0) {
-                    err_msg << " : must be list of key-value pairs";
-                    return false;
-                }
-                for (size_t i = 0; i < init.size(); i += 2) {
-                    auto t = (begin(init) + i)->val.view().type();
-                    if (t != type::k_string) {
-                        err_msg << " : all keys must be string type. ";
-                        err_msg << "Found type=" << to_string(t);
-                        return false;
-                    }
-                }
-                return true;
-            }();
+    list(initializer_list_t init, bool type_deduction, bool is_array) {
+        bool const as_document = (type_deduction || !is_array) && is_key_value_list(init);
+
+        if (!as_document && !(type_deduction || is_array)) {
+            throw bsoncxx::v_noabi::exception{error_code::k_unmatched_key_in_builder, document_error(init)};
         }
 
-        if (valid_document) {
-            core _core{false};
-            for (size_t i = 0; i < init.size(); i += 2) {
-                _core.key_owned(std::string((begin(init) + i)->val.view().get_string().value));
-                _core.append((begin(init) + i + 1)->val);
+        core _core{!as_document};
+
+        if (as_document) {
+            for (auto iter = init.begin(); iter != init.end(); iter += 2) {
+                // The key is appended before the list it refers to is destroyed.
+                _core.key_view(iter->val.get_string().value);
+                _core.append((iter + 1)->val);
             }
-            val = types::bson_value::value(_core.extract_document());
-        } else if (type_deduction || is_array) {
-            core _core{true};
-            for (auto&& ele : init)
+
+            encoded.emplace(_core.extract_document());
+            view_encoded(false);
+        } else {
+            for (auto const& ele : init) {
                 _core.append(ele.val);
-            val = types::bson_value::value(_core.extract_array());
+            }
+
+            auto arr = _core.extract_array();
+            auto const length = arr.view().length();
+            encoded.emplace(arr.release(), length);
+            view_encoded(true);
+        }
+    }
+
+    void assign_string(char const* value, std::size_t size) {
+        char const* const end = std::char_traits<char>::find(value, size, '\0');
+        std::size_t const length = end ? static_cast<std::size_t>(end - value) : size;
+
+        if (length < k_inline_string_length) {
+            std::memcpy(inline_string, value, length);
+            val = types::bson_value::view{types::b_string{stdx::string_view{inline_string, length}}};
+        } else {
+            owned.emplace(stdx::string_view{value, length});
+            val = owned->view();
+        }
+    }
+
+    // Points `val` at the owning members of this list after they were copied or moved from `other`.
+    void rebind(list const& other) {
+        if (owned) {
+            val = owned->view();
+        } else if (encoded) {
+            view_encoded(val.type() == type::k_array);
+        } else if (val.type() == type::k_string && val.get_string().value.data() == other.inline_string) {
+            std::size_t const length = val.get_string().value.size();
+            std::memcpy(inline_string, other.inline_string, length);
+            val = types::bson_value::view{types::b_string{stdx::string_view{inline_string, length}}};
+        }
+    }
+
+    // Points `val` at `encoded`.
+    void view_encoded(bool is_array) {
+        if (is_array) {
+            val = types::bson_value::view{
+                types::b_array{bsoncxx::v_noabi::array::view{encoded->data(), encoded->length()}}};
         } else {
-            throw bsoncxx::v_noabi::exception{error_code::k_unmatched_key_in_builder, err_msg.str()};
+            val = types::bson_value::view{types::b_document{encoded->view()}};
+        }
+    }
+
+    static bool is_key_value_list(initializer_list_t init) {
+        if (init.size() % 2 != 0) {
+            return false;
+        }
+
+        for (auto iter = init.begin(); iter != init.end(); iter += 2) {
+            if (iter->val.type() != type::k_string) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Only called on failure: describes why `init` is not a list of key-value pairs.
+    static std::string document_error(initializer_list_t init) {
+        std::string msg{"cannot construct document"};
+
+        if (init.size() % 2 != 0) {
+            return msg + " : must be list of key-value pairs";
         }
+
+        for (auto iter = init.begin(); iter != init.end(); iter += 2) {
+            auto const t = iter->val.type();
+
+            if (t != type::k_string) {
+                return msg + " : all keys must be string type. Found type=" + to_string(t);
+            }
+        }
+
+        return msg;
     }
 };
 
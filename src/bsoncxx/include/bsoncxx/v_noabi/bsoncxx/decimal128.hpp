@@ -14,11 +14,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
 #include <bsoncxx/decimal128-fwd.hpp>
 
+#include <bsoncxx/stdx/optional.hpp>
 #include <bsoncxx/stdx/string_view.hpp>
 
 #include <bsoncxx/config/prelude.hpp>
@@ -39,6 +41,11 @@ namespace v_noabi {
 ///
 class decimal128 {
    public:
+    ///
+    /// The maximum number of characters in the string representation of a BSON Decimal128.
+    ///
+    static constexpr std::size_t k_max_string_length = 42;
+
     ///
     /// Constructs a BSON Decimal128 value representing zero.
     ///
@@ -72,6 +79,65 @@ class decimal128 {
     ///
     BSONCXX_ABI_EXPORT_CDECL(std::string) to_string() const;
 
+    ///
+    /// Writes the string representation of this decimal128 value into a caller-provided buffer.
+    ///
+    /// No null terminator is written.
+    ///
+    /// @param out
+    ///   A buffer with room for at least @ref k_max_string_length characters.
+    ///
+    /// @return A pointer one past the last character written.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(char*) to_chars(char* out) const;
+
+    ///
+    /// Parses a BSON Decimal128 from a string without copying or throwing.
+    ///
+    /// @param str
+    ///     A string representation of a decimal number.
+    ///
+    /// @return An engaged optional containing the parsed value, or an unengaged optional if the
+    /// string isn't a valid BSON Decimal128 representation.
+    ///
+    static BSONCXX_ABI_EXPORT_CDECL(stdx::optional<decimal128>) from_chars(stdx::string_view str);
+
+    ///
+    /// Parses each string in the range [first, last) into the corresponding element of `out`.
+    ///
+    /// @param first
+    ///     The first string to parse.
+    /// @param last
+    ///     One past the last string to parse.
+    /// @param out
+    ///     An array with room for at least `last - first` values.
+    ///
+    /// @return The number of strings parsed. Parsing stops at the first string that isn't a valid
+    /// BSON Decimal128 representation, so a return value less than `last - first` is the index of
+    /// that string.
+    ///
+    static BSONCXX_ABI_EXPORT_CDECL(std::size_t)
+        from_chars(stdx::string_view const* first, stdx::string_view const* last, decimal128* out);
+
+    ///
+    /// Writes the string representation of each value in the range [first, last) into a
+    /// caller-provided buffer, back to back, without separators or null terminators.
+    ///
+    /// @param first
+    ///     The first value to convert.
+    /// @param last
+    ///     One past the last value to convert.
+    /// @param out
+    ///     A buffer with room for at least `(last - first) * k_max_string_length` characters.
+    /// @param ends
+    ///     If non-null, an array with room for `last - first` pointers, each of which is set to one
+    ///     past the last character written for the corresponding value.
+    ///
+    /// @return A pointer one past the last character written.
+    ///
+    static BSONCXX_ABI_EXPORT_CDECL(char*)
+        to_chars(decimal128 const* first, decimal128 const* last, char* out, char** ends = nullptr);
+
     ///
     /// @relates bsoncxx::v_noabi::decimal128
     ///
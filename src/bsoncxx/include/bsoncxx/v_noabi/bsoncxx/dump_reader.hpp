@@ -0,0 +1,158 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <bsoncxx/dump_reader-fwd.hpp>
+
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <bsoncxx/validate-fwd.hpp>
+
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/stdx/string_view.hpp>
+
+#include <bsoncxx/config/prelude.hpp>
+
+namespace bsoncxx {
+namespace v_noabi {
+
+///
+/// A read-only memory mapping of a file containing a sequence of BSON documents laid out back to
+/// back, such as the `.bson` files written by `mongodump`.
+///
+/// Documents are never copied: every document::view refers directly into the mapping and remains
+/// valid for the lifetime of the dump_reader. When the file is opened, the offset of every document
+/// is indexed by following the length prefixes, which provides random access to the documents.
+/// Indexing stops at the first length prefix which is invalid or extends past the end of the file,
+/// e.g. in a truncated dump; see @ref indexed_length.
+///
+/// The contents of the documents are not validated unless @ref validate is called.
+///
+class dump_reader {
+   public:
+    ///
+    /// A random access iterator over the indexed documents.
+    ///
+    using const_iterator = document::view const*;
+
+    ///
+    /// Opens and maps a file, and indexes the documents it contains.
+    ///
+    /// @param path
+    ///   The path of the file.
+    ///
+    /// @throws bsoncxx::v_noabi::exception with error code @ref
+    ///   bsoncxx::v_noabi::error_code::k_cannot_map_file if the file cannot be opened or mapped.
+    ///
+    explicit BSONCXX_ABI_EXPORT_CDECL() dump_reader(stdx::string_view path);
+
+    ///
+    /// Move constructs a dump_reader.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL() dump_reader(dump_reader&&) noexcept;
+
+    ///
+    /// Move assigns a dump_reader.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(dump_reader&) operator=(dump_reader&&) noexcept;
+
+    dump_reader(dump_reader const&) = delete;
+    dump_reader& operator=(dump_reader const&) = delete;
+
+    ///
+    /// Unmaps the file. Views of its documents are invalidated.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL() ~dump_reader();
+
+    ///
+    /// The contents of the file.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(std::uint8_t const*) data() const;
+
+    ///
+    /// The size of the file in bytes.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(std::size_t) length() const;
+
+    ///
+    /// The number of bytes from the start of the file which are covered by indexed documents.
+    /// Less than @ref length if the file ends partway through a document or contains an invalid
+    /// length prefix.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(std::size_t) indexed_length() const;
+
+    ///
+    /// The number of indexed documents.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(std::size_t) size() const;
+
+    ///
+    /// Returns true if no documents were indexed.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(bool) empty() const;
+
+    ///
+    /// The document at the given position in the file.
+    ///
+    /// @param index
+    ///   The index of the document. Must be less than @ref size.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(document::view) operator[](std::size_t index) const;
+
+    ///
+    /// @return An iterator to the first document.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(const_iterator) begin() const;
+
+    ///
+    /// @return An iterator past the last indexed document.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(const_iterator) end() const;
+
+    ///
+    /// Validates every indexed document with the same checks as @ref bsoncxx::v_noabi::validate.
+    ///
+    /// @param validator
+    ///   A validator used to configure what checks are done.
+    /// @param invalid_offset
+    ///   If validation fails, the offset from the start of the file at which the first invalid
+    ///   document was found to be invalid will be stored here (if non-null).
+    /// @param thread_count
+    ///   The number of threads to validate with. The documents are split into ranges of roughly
+    ///   equal size in bytes. Zero uses `std::thread::hardware_concurrency()` threads.
+    ///
+    /// @return True if every indexed document is valid.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(bool)
+    validate(validator const& validator, std::size_t* invalid_offset = nullptr, std::size_t thread_count = 1u) const;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace bsoncxx
+
+#include <bsoncxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref bsoncxx::v_noabi::dump_reader.
+///
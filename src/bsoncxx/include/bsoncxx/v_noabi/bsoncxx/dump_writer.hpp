@@ -0,0 +1,178 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <bsoncxx/dump_writer-fwd.hpp>
+
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/stdx/string_view.hpp>
+
+#include <bsoncxx/config/prelude.hpp>
+
+namespace bsoncxx {
+namespace v_noabi {
+
+///
+/// Writes a sequence of BSON documents laid out back to back, such as the `.bson` files written
+/// by `mongodump`, to a file or file descriptor with bounded memory.
+///
+/// Documents are copied into page-aligned buffers of a fixed size, and each buffer is written with
+/// a single system call once it is full. Documents larger than a buffer are written directly
+/// together with the pending buffer (using `writev` where available) without being copied.
+///
+/// With background flushing, full buffers are written by a dedicated thread while the next buffer
+/// is filled. At most two buffers are allocated: when the background thread falls behind,
+/// @ref write blocks until the buffer being written has been written.
+///
+/// Errors are reported by the first call to @ref write or @ref flush after they occur. A
+/// dump_writer must not be used concurrently by multiple threads.
+///
+/// @see
+/// - @ref bsoncxx::v_noabi::dump_reader
+///
+class dump_writer {
+   public:
+    ///
+    /// The default size of each buffer.
+    ///
+    static constexpr std::size_t k_default_buffer_size = std::size_t{1} << 20;
+
+    ///
+    /// Creates or truncates a file and writes documents to it.
+    ///
+    /// @param path
+    ///   The path of the file.
+    /// @param buffer_size
+    ///   The size of each buffer. Rounded up to a multiple of the page size (4096 bytes).
+    /// @param background
+    ///   If true, full buffers are written by a background thread.
+    ///
+    /// @throws bsoncxx::v_noabi::exception with error code @ref
+    ///   bsoncxx::v_noabi::error_code::k_cannot_write_file if the file cannot be opened.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL()
+    dump_writer(stdx::string_view path, std::size_t buffer_size = k_default_buffer_size, bool background = false);
+
+    ///
+    /// Writes documents to an open file descriptor, e.g. of a file, pipe, or socket. The file
+    /// descriptor is not closed by the dump_writer.
+    ///
+    /// @param fd
+    ///   A file descriptor open for writing. On Windows, a C runtime file descriptor.
+    /// @param buffer_size
+    ///   The size of each buffer. Rounded up to a multiple of the page size (4096 bytes).
+    /// @param background
+    ///   If true, full buffers are written by a background thread.
+    ///
+    /// @note When writing to a socket or pipe on POSIX systems, the application should ignore
+    /// `SIGPIPE` to receive an error instead of a signal if the peer closes the connection.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL()
+    dump_writer(int fd, std::size_t buffer_size = k_default_buffer_size, bool background = false);
+
+    ///
+    /// Move constructs a dump_writer.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL() dump_writer(dump_writer&&) noexcept;
+
+    ///
+    /// Move assigns a dump_writer. Pending documents of this dump_writer are written first, and
+    /// errors doing so are ignored.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(dump_writer&) operator=(dump_writer&&) noexcept;
+
+    dump_writer(dump_writer const&) = delete;
+    dump_writer& operator=(dump_writer const&) = delete;
+
+    ///
+    /// Writes any pending documents and closes the file if it was opened by the dump_writer.
+    /// Errors are ignored: call @ref flush first to observe them.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL() ~dump_writer();
+
+    ///
+    /// Appends a document.
+    ///
+    /// @param doc
+    ///   The document. Its bytes are written as-is.
+    ///
+    /// @return
+    ///   A reference to this object to facilitate method chaining.
+    ///
+    /// @throws bsoncxx::v_noabi::exception with error code @ref
+    ///   bsoncxx::v_noabi::error_code::k_cannot_write_file if writing a buffer failed.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(dump_writer&) write(document::view doc);
+
+    ///
+    /// Appends every document of a range, e.g. the results of a cursor.
+    ///
+    /// @param first
+    ///   An input iterator to the first document.
+    /// @param last
+    ///   An input iterator past the last document.
+    ///
+    /// @return
+    ///   A reference to this object to facilitate method chaining.
+    ///
+    /// @throws bsoncxx::v_noabi::exception with error code @ref
+    ///   bsoncxx::v_noabi::error_code::k_cannot_write_file if writing a buffer failed.
+    ///
+    template <typename InputIterator>
+    dump_writer& write(InputIterator first, InputIterator last) {
+        for (; first != last; ++first) {
+            write(document::view{*first});
+        }
+        return *this;
+    }
+
+    ///
+    /// Writes every pending document, waiting for the background thread if necessary.
+    ///
+    /// @throws bsoncxx::v_noabi::exception with error code @ref
+    ///   bsoncxx::v_noabi::error_code::k_cannot_write_file if writing a buffer failed.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(void) flush();
+
+    ///
+    /// The number of documents appended so far, including pending documents.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(std::size_t) documents_written() const;
+
+    ///
+    /// The number of bytes appended so far, including pending documents.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(std::uint64_t) bytes_written() const;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace bsoncxx
+
+#include <bsoncxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref bsoncxx::v_noabi::dump_writer.
+///
@@ -152,6 +152,15 @@ enum class error_code : std::int32_t {
     /// Attempted out-of-range access to a BSON Binary Vector element.
     k_vector_out_of_range,
 
+    /// Attempted an operation on BSON Binary Vectors with different numbers of elements.
+    k_vector_size_mismatch,
+
+    /// A file of BSON documents could not be opened or mapped into memory.
+    k_cannot_map_file,
+
+    /// A sequence of BSON documents could not be written to a file.
+    k_cannot_write_file,
+
     // Add new constant string message to error_code.cpp as well!
 };
 
@@ -24,6 +24,7 @@
 #include <bsoncxx/builder/basic/sub_document-fwd.hpp>
 #include <bsoncxx/builder/concatenate-fwd.hpp>
 #include <bsoncxx/builder/core-fwd.hpp>
+#include <bsoncxx/builder/document_template-fwd.hpp>
 #include <bsoncxx/builder/list-fwd.hpp>
 #include <bsoncxx/builder/stream/array-fwd.hpp>
 #include <bsoncxx/builder/stream/array_context-fwd.hpp>
@@ -37,6 +38,8 @@
 #include <bsoncxx/document/element-fwd.hpp>
 #include <bsoncxx/document/value-fwd.hpp>
 #include <bsoncxx/document/view-fwd.hpp>
+#include <bsoncxx/dump_reader-fwd.hpp>
+#include <bsoncxx/dump_writer-fwd.hpp>
 #include <bsoncxx/exception/error_code-fwd.hpp>
 #include <bsoncxx/exception/exception-fwd.hpp>
 #include <bsoncxx/json-fwd.hpp>
@@ -20,6 +20,7 @@
 
 #include <bsoncxx/oid-fwd.hpp>
 
+#include <bsoncxx/stdx/optional.hpp>
 #include <bsoncxx/stdx/string_view.hpp>
 
 #include <bsoncxx/config/prelude.hpp>
@@ -37,9 +38,17 @@ class oid {
    public:
     static constexpr std::size_t k_oid_length = 12;
 
+    ///
+    /// The number of characters in the hexadecimal representation of an ObjectId.
+    ///
+    static constexpr std::size_t k_oid_string_length = 2 * k_oid_length;
+
     ///
     /// Constructs an oid and initializes it to a newly generated ObjectId.
     ///
+    /// Each thread generates ObjectIds from its own counter and process-unique value, so
+    /// concurrent generation does not contend on shared state.
+    ///
     BSONCXX_ABI_EXPORT_CDECL() oid();
 
     ///
@@ -72,6 +81,29 @@ class oid {
     ///
     BSONCXX_ABI_EXPORT_CDECL(std::string) to_string() const;
 
+    ///
+    /// Writes the lowercase hexadecimal representation of this oid into a caller-provided buffer.
+    ///
+    /// No null terminator is written.
+    ///
+    /// @param out
+    ///   A buffer with room for at least @ref k_oid_string_length characters.
+    ///
+    /// @return A pointer one past the last character written.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(char*) to_chars(char* out) const;
+
+    ///
+    /// Parses the hexadecimal representation of an ObjectId without throwing.
+    ///
+    /// @param str
+    ///   A string of exactly @ref k_oid_string_length hexadecimal characters (in either case).
+    ///
+    /// @return An engaged optional containing the parsed oid, or an unengaged optional if `str` is
+    /// not an OID-sized hex string.
+    ///
+    static BSONCXX_ABI_EXPORT_CDECL(stdx::optional<oid>) from_chars(stdx::string_view str);
+
     ///
     /// Returns the number of bytes in this ObjectId.
     ///
@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include <bsoncxx/validate-fwd.hpp>
 
@@ -71,6 +73,32 @@ validate(
     validator const& validator,
     std::size_t* invalid_offset = nullptr);
 
+///
+/// Validates a contiguous sequence of BSON documents, such as the contents of a BSON dump or an
+/// OP_MSG document sequence, with the same checks as @ref validate.
+///
+/// @param data
+///   A buffer containing zero or more BSON documents laid out back to back.
+/// @param length
+///   The size of the buffer.
+/// @param validator
+///   A validator used to configure what checks are done.
+/// @param invalid_offset
+///   If validation fails, the offset from the start of `data` at which the sequence was found to
+///   be invalid will be stored here (if non-null).
+///
+/// @returns
+///   An engaged optional containing a view of each document in order if every document is valid,
+///   or an unengaged optional if any document is invalid or the buffer ends partway through a
+///   document.
+///
+BSONCXX_ABI_EXPORT_CDECL(stdx::optional<std::vector<document::view>>)
+validate_sequence(
+    std::uint8_t const* data,
+    std::size_t length,
+    validator const& validator,
+    std::size_t* invalid_offset = nullptr);
+
 ///
 /// Used to toggle checks which may be performed during BSON validation.
 ///
@@ -163,6 +191,7 @@ class validator {
 namespace bsoncxx {
 
 using ::bsoncxx::v_noabi::validate;
+using ::bsoncxx::v_noabi::validate_sequence;
 
 } // namespace bsoncxx
 
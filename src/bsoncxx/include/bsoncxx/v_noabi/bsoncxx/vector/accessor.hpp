@@ -20,6 +20,7 @@
 
 #include <type_traits>
 
+#include <bsoncxx/builder/basic/sub_array-fwd.hpp>
 #include <bsoncxx/builder/basic/sub_binary-fwd.hpp>
 
 #include <bsoncxx/exception/error_code.hpp>
@@ -330,8 +331,10 @@ class accessor {
     }
 
    private:
+    friend class bsoncxx::v_noabi::builder::basic::sub_array;
     friend class bsoncxx::v_noabi::builder::basic::sub_binary;
     friend class accessor<typename std::remove_const<format>::type>;
+    friend struct detail::accessor_access;
 
     accessor(detail::accessor_data<format> data) noexcept : _data{data} {}
 
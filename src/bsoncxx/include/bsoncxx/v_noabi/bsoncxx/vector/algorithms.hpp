@@ -0,0 +1,163 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <bsoncxx/vector/accessor.hpp>
+#include <bsoncxx/vector/formats.hpp>
+
+#include <bsoncxx/config/prelude.hpp>
+
+namespace bsoncxx {
+namespace v_noabi {
+namespace vector {
+
+/// @brief Copy every element of a float32 vector into a contiguous array.
+/// @param vec Vector to read. Use accessor::as_const() to pass a mutable accessor.
+/// @param out Array with room for at least `vec.size()` elements.
+BSONCXX_ABI_EXPORT_CDECL(void) copy_to(accessor<formats::f_float32 const> const& vec, float* out);
+
+/// @brief Copy every element of an int8 vector into a contiguous array.
+/// @param vec Vector to read. Use accessor::as_const() to pass a mutable accessor.
+/// @param out Array with room for at least `vec.size()` elements.
+BSONCXX_ABI_EXPORT_CDECL(void) copy_to(accessor<formats::f_int8 const> const& vec, std::int8_t* out);
+
+/// @brief Copy the packed bits of a packed_bit vector into a contiguous array of bytes.
+/// @param vec Vector to read. Use accessor::as_const() to pass a mutable accessor.
+/// @param out Array with room for at least `vec.byte_size()` bytes. Bits are packed most significant bit first, and
+/// unused bits in the last byte are zero.
+BSONCXX_ABI_EXPORT_CDECL(void) copy_to(accessor<formats::f_packed_bit const> const& vec, std::uint8_t* out);
+
+/// @brief Overwrite every element of a float32 vector from a contiguous array.
+/// @param vec Vector to write.
+/// @param in Array of at least `vec.size()` elements.
+BSONCXX_ABI_EXPORT_CDECL(void) copy_from(accessor<formats::f_float32> const& vec, float const* in);
+
+/// @brief Overwrite every element of an int8 vector from a contiguous array.
+/// @param vec Vector to write.
+/// @param in Array of at least `vec.size()` elements.
+BSONCXX_ABI_EXPORT_CDECL(void) copy_from(accessor<formats::f_int8> const& vec, std::int8_t const* in);
+
+/// @brief Overwrite every element of a packed_bit vector from a contiguous array of packed bytes.
+/// @param vec Vector to write.
+/// @param in Array of at least `vec.byte_size()` bytes, packed most significant bit first. Unused bits in the last
+/// byte are ignored and written as zero.
+BSONCXX_ABI_EXPORT_CDECL(void) copy_from(accessor<formats::f_packed_bit> const& vec, std::uint8_t const* in);
+
+/// @brief Compute the dot product of two float32 vectors.
+/// @throws bsoncxx::v_noabi::exception with bsoncxx::v_noabi::error_code::k_vector_size_mismatch if the vectors have
+/// different sizes.
+///
+/// Elements are accumulated in several independent lanes, so the result may differ in the last bits from a
+/// sequential sum.
+BSONCXX_ABI_EXPORT_CDECL(float)
+dot(accessor<formats::f_float32 const> const& a, accessor<formats::f_float32 const> const& b);
+
+/// @brief Compute the dot product of a float32 vector and a contiguous array.
+/// @param query Array of at least `vec.size()` elements.
+BSONCXX_ABI_EXPORT_CDECL(float) dot(accessor<formats::f_float32 const> const& vec, float const* query);
+
+/// @brief Compute the dot product of two int8 vectors.
+/// @throws bsoncxx::v_noabi::exception with bsoncxx::v_noabi::error_code::k_vector_size_mismatch if the vectors have
+/// different sizes.
+BSONCXX_ABI_EXPORT_CDECL(std::int64_t)
+dot(accessor<formats::f_int8 const> const& a, accessor<formats::f_int8 const> const& b);
+
+/// @brief Compute the dot product of an int8 vector and a contiguous array.
+/// @param query Array of at least `vec.size()` elements.
+BSONCXX_ABI_EXPORT_CDECL(std::int64_t) dot(accessor<formats::f_int8 const> const& vec, std::int8_t const* query);
+
+/// @brief Compute the Euclidean (L2) distance between two float32 vectors.
+/// @throws bsoncxx::v_noabi::exception with bsoncxx::v_noabi::error_code::k_vector_size_mismatch if the vectors have
+/// different sizes.
+BSONCXX_ABI_EXPORT_CDECL(float)
+l2_distance(accessor<formats::f_float32 const> const& a, accessor<formats::f_float32 const> const& b);
+
+/// @brief Compute the Euclidean (L2) distance between a float32 vector and a contiguous array.
+/// @param query Array of at least `vec.size()` elements.
+BSONCXX_ABI_EXPORT_CDECL(float) l2_distance(accessor<formats::f_float32 const> const& vec, float const* query);
+
+/// @brief Compute the Euclidean (L2) distance between two int8 vectors.
+/// @throws bsoncxx::v_noabi::exception with bsoncxx::v_noabi::error_code::k_vector_size_mismatch if the vectors have
+/// different sizes.
+BSONCXX_ABI_EXPORT_CDECL(float)
+l2_distance(accessor<formats::f_int8 const> const& a, accessor<formats::f_int8 const> const& b);
+
+/// @brief Compute the Euclidean (L2) distance between an int8 vector and a contiguous array.
+/// @param query Array of at least `vec.size()` elements.
+BSONCXX_ABI_EXPORT_CDECL(float) l2_distance(accessor<formats::f_int8 const> const& vec, std::int8_t const* query);
+
+/// @brief Compute the cosine similarity of two float32 vectors.
+/// @return A value in the range [-1, 1], or zero if either vector has zero magnitude.
+/// @throws bsoncxx::v_noabi::exception with bsoncxx::v_noabi::error_code::k_vector_size_mismatch if the vectors have
+/// different sizes.
+BSONCXX_ABI_EXPORT_CDECL(float)
+cosine_similarity(accessor<formats::f_float32 const> const& a, accessor<formats::f_float32 const> const& b);
+
+/// @brief Compute the cosine similarity of a float32 vector and a contiguous array.
+/// @param query Array of at least `vec.size()` elements.
+/// @return A value in the range [-1, 1], or zero if either vector has zero magnitude.
+BSONCXX_ABI_EXPORT_CDECL(float) cosine_similarity(accessor<formats::f_float32 const> const& vec, float const* query);
+
+/// @brief Compute the cosine similarity of two int8 vectors.
+/// @return A value in the range [-1, 1], or zero if either vector has zero magnitude.
+/// @throws bsoncxx::v_noabi::exception with bsoncxx::v_noabi::error_code::k_vector_size_mismatch if the vectors have
+/// different sizes.
+BSONCXX_ABI_EXPORT_CDECL(float)
+cosine_similarity(accessor<formats::f_int8 const> const& a, accessor<formats::f_int8 const> const& b);
+
+/// @brief Compute the cosine similarity of an int8 vector and a contiguous array.
+/// @param query Array of at least `vec.size()` elements.
+/// @return A value in the range [-1, 1], or zero if either vector has zero magnitude.
+BSONCXX_ABI_EXPORT_CDECL(float)
+cosine_similarity(accessor<formats::f_int8 const> const& vec, std::int8_t const* query);
+
+/// @brief Count the elements that differ between two packed_bit vectors.
+/// @throws bsoncxx::v_noabi::exception with bsoncxx::v_noabi::error_code::k_vector_size_mismatch if the vectors have
+/// different sizes.
+BSONCXX_ABI_EXPORT_CDECL(std::size_t)
+hamming_distance(accessor<formats::f_packed_bit const> const& a, accessor<formats::f_packed_bit const> const& b);
+
+/// @brief Count the elements that differ between a packed_bit vector and a contiguous array of packed bytes.
+/// @param query Array of at least `vec.byte_size()` bytes, packed most significant bit first. Unused bits in the last
+/// byte are ignored.
+BSONCXX_ABI_EXPORT_CDECL(std::size_t)
+hamming_distance(accessor<formats::f_packed_bit const> const& vec, std::uint8_t const* query);
+
+} // namespace vector
+} // namespace v_noabi
+} // namespace bsoncxx
+
+namespace bsoncxx {
+namespace vector {
+
+using ::bsoncxx::v_noabi::vector::copy_from;
+using ::bsoncxx::v_noabi::vector::copy_to;
+using ::bsoncxx::v_noabi::vector::cosine_similarity;
+using ::bsoncxx::v_noabi::vector::dot;
+using ::bsoncxx::v_noabi::vector::hamming_distance;
+using ::bsoncxx::v_noabi::vector::l2_distance;
+
+} // namespace vector
+} // namespace bsoncxx
+
+#include <bsoncxx/config/postlude.hpp>
+
+///
+/// @file
+/// Declares bulk copy and similarity operations on @ref bsoncxx::v_noabi::vector::accessor.
+///
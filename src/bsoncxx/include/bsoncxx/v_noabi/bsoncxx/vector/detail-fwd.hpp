@@ -27,6 +27,8 @@ struct format_traits;
 template <typename Format>
 struct accessor_data;
 
+struct accessor_access;
+
 } // namespace detail
 } // namespace vector
 } // namespace v_noabi
@@ -23,6 +23,7 @@
 #include <cstring>
 
 #include <bsoncxx/types.hpp>
+#include <bsoncxx/vector/accessor-fwd.hpp>
 #include <bsoncxx/vector/elements.hpp>
 #include <bsoncxx/vector/formats.hpp>
 #include <bsoncxx/vector/iterators.hpp>
@@ -64,6 +65,14 @@ struct accessor_data {
     }
 };
 
+// @brief Implementation detail. Grants the bulk vector operations access to an accessor's underlying bytes.
+struct accessor_access {
+    template <typename Format>
+    static constexpr accessor_data<Format> const& data(accessor<Format> const& vec) noexcept {
+        return vec._data;
+    }
+};
+
 // @brief Implementation detail. Default format traits.
 struct format_traits_base {
     using element_count_type = std::size_t;
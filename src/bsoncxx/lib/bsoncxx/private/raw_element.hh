@@ -0,0 +1,157 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <bsoncxx/stdx/string_view.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <bsoncxx/private/bson.hh>
+
+namespace bsoncxx {
+
+// Decodes a BSON element directly from its bytes: the type byte at `offset`, the key that follows
+// it, and the value after the key's NUL terminator.
+//
+// Note: the element must already have been validated by libbson (e.g. by
+// `bson_iter_init_from_data_at_offset`), as is the case for every element obtained by iterating
+// or looking up a key in a view. No bounds checks are performed here.
+class raw_element {
+   public:
+    raw_element(std::uint8_t const* raw, std::uint32_t offset, std::uint32_t keylen)
+        : _raw(raw), _offset(offset), _keylen(keylen) {}
+
+    bsoncxx::v_noabi::type type() const {
+        return static_cast<bsoncxx::v_noabi::type>(_raw[_offset]);
+    }
+
+    stdx::string_view key() const {
+        return stdx::string_view{reinterpret_cast<char const*>(_raw + _offset + 1u), _keylen};
+    }
+
+    std::uint8_t const* value() const {
+        return _raw + value_offset();
+    }
+
+    std::uint32_t value_offset() const {
+        return _offset + 1u + _keylen + 1u;
+    }
+
+    // Computes the offset of the element following this one from the size of its value. Returns
+    // false if the element's type is not recognized, in which case callers should fall back to
+    // libbson.
+    bool next_offset(std::uint32_t* out) const {
+        std::uint32_t const off = value_offset();
+        std::uint8_t const* const v = _raw + off;
+
+        std::uint32_t size = 0u;
+
+        switch (_raw[_offset]) {
+            case BSON_TYPE_UNDEFINED:
+            case BSON_TYPE_NULL:
+            case BSON_TYPE_MAXKEY:
+            case BSON_TYPE_MINKEY:
+                break;
+
+            case BSON_TYPE_BOOL:
+                size = 1u;
+                break;
+
+            case BSON_TYPE_INT32:
+                size = 4u;
+                break;
+
+            case BSON_TYPE_DOUBLE:
+            case BSON_TYPE_DATE_TIME:
+            case BSON_TYPE_TIMESTAMP:
+            case BSON_TYPE_INT64:
+                size = 8u;
+                break;
+
+            case BSON_TYPE_OID:
+                size = 12u;
+                break;
+
+            case BSON_TYPE_DECIMAL128:
+                size = 16u;
+                break;
+
+            case BSON_TYPE_UTF8:
+            case BSON_TYPE_CODE:
+            case BSON_TYPE_SYMBOL:
+                size = 4u + load_uint32(v);
+                break;
+
+            // The leading int32 of these types is the size of the entire value.
+            case BSON_TYPE_DOCUMENT:
+            case BSON_TYPE_ARRAY:
+            case BSON_TYPE_CODEWSCOPE:
+                size = load_uint32(v);
+                break;
+
+            // int32 length, one subtype byte, then the data.
+            case BSON_TYPE_BINARY:
+                size = 4u + 1u + load_uint32(v);
+                break;
+
+            // string followed by a 12-byte oid.
+            case BSON_TYPE_DBPOINTER:
+                size = 4u + load_uint32(v) + 12u;
+                break;
+
+            // Two consecutive cstrings: the pattern and the options.
+            case BSON_TYPE_REGEX: {
+                char const* const pattern = reinterpret_cast<char const*>(v);
+                std::size_t const pattern_len = std::strlen(pattern) + 1u;
+                size = static_cast<std::uint32_t>(pattern_len + std::strlen(pattern + pattern_len) + 1u);
+                break;
+            }
+
+            default:
+                return false;
+        }
+
+        *out = off + size;
+        return true;
+    }
+
+    static std::uint32_t load_uint32(std::uint8_t const* p) {
+        std::uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return BSON_UINT32_FROM_LE(v);
+    }
+
+    static std::uint64_t load_uint64(std::uint8_t const* p) {
+        std::uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return BSON_UINT64_FROM_LE(v);
+    }
+
+    static double load_double(std::uint8_t const* p) {
+        double v;
+        std::memcpy(&v, p, sizeof(v));
+        return BSON_DOUBLE_FROM_LE(v);
+    }
+
+   private:
+    std::uint8_t const* _raw;
+    std::uint32_t _offset;
+    std::uint32_t _keylen;
+};
+
+} // namespace bsoncxx
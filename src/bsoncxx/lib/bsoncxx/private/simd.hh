@@ -0,0 +1,24 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+// SSE2 is part of the x86-64 baseline, so it may be used unconditionally where the compiler targets
+// it. Code guarded by `BSONCXX_PRIVATE_SIMD_SSE2` must provide a portable fallback.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BSONCXX_PRIVATE_SIMD_SSE2 1
+#else
+#define BSONCXX_PRIVATE_SIMD_SSE2 0
+#endif
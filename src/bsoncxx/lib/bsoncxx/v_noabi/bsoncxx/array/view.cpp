@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
 #include <cstring>
 #include <tuple>
 
@@ -21,6 +22,7 @@
 
 #include <bsoncxx/private/bson.hh>
 #include <bsoncxx/private/itoa.hh>
+#include <bsoncxx/private/raw_element.hh>
 
 namespace bsoncxx {
 namespace v_noabi {
@@ -55,9 +57,26 @@ view::const_iterator& view::const_iterator::operator++() {
     auto raw = _element.raw();
     auto len = _element.length();
 
-    bson_iter_t iter = to_bson_iter_t(_element);
+    std::uint32_t next;
 
-    if (!bson_iter_next(&iter)) {
+    if (!raw_element{raw, _element.offset(), _element.keylen()}.next_offset(&next)) {
+        // Unrecognized element type: let libbson find the next element.
+        bson_iter_t iter = to_bson_iter_t(_element);
+
+        if (!bson_iter_next(&iter)) {
+            _element = element{};
+        } else {
+            _element = element{raw, len, bson_iter_offset(&iter), bson_iter_key_len(&iter)};
+        }
+
+        return *this;
+    }
+
+    // The current element was validated when it was reached, so only the next one needs to be
+    // parsed. The final byte of the document is its terminating NUL.
+    bson_iter_t iter;
+
+    if (next >= len - 1u || !bson_iter_init_from_data_at_offset(&iter, raw, len, next, 0u)) {
         _element = element{};
     } else {
         _element = element{raw, len, bson_iter_offset(&iter), bson_iter_key_len(&iter)};
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
 #include <cstring>
 
 #include <bsoncxx/builder/core.hpp>
@@ -134,6 +135,11 @@ class core::impl {
         _stack.pop_back();
     }
 
+    // The index of the next element of the current array.
+    std::size_t next_index() {
+        return _stack.empty() ? _n : _stack.back().n;
+    }
+
     // Throws bsoncxx::v_noabi::exception if the current BSON datum is a document that is waiting
     // for a key to be appended to start a new key/value pair.
     stdx::string_view next_key() {
@@ -366,6 +372,80 @@ uint8_t* core::append(binary_sub_type sub_type, uint32_t length) {
     return allocated_bytes;
 }
 
+void core::append(binary_sub_type sub_type, uint32_t length, std::size_t count, uint8_t** binary_data) {
+    if (!_impl->is_array()) {
+        throw bsoncxx::v_noabi::exception{error_code::k_cannot_perform_array_operation_on_document};
+    }
+
+    // The old binary subtype wraps its data in a second length, which the headers written below do not have.
+    if (sub_type == binary_sub_type::k_binary_deprecated) {
+        throw bsoncxx::v_noabi::exception{error_code::k_cannot_append_binary};
+    }
+
+    if (count == 0u) {
+        return;
+    }
+
+    // Each element is a type byte, the key and its terminator, the length, the subtype and the data.
+    std::size_t const fixed_size = 1u + 1u + sizeof(std::int32_t) + 1u + std::size_t{length};
+    std::size_t const first_index = _impl->next_index();
+
+    if (count > std::size_t{INT32_MAX} / fixed_size || first_index > std::size_t{UINT32_MAX} - count) {
+        throw bsoncxx::v_noabi::exception{error_code::k_cannot_append_binary};
+    }
+
+    // The keys are the decimal indexes of the elements. Every size is validated before any key is consumed.
+    std::size_t size = count * fixed_size;
+
+    for (std::size_t i = 0u; i < count; ++i) {
+        size += itoa{static_cast<std::uint32_t>(first_index + i)}.length();
+
+        if (size > std::size_t{INT32_MAX}) {
+            throw bsoncxx::v_noabi::exception{error_code::k_cannot_append_binary};
+        }
+    }
+
+    // The array grows once, by a single element spanning every element. Its bytes are then rewritten in place:
+    // the first element keeps the same header but for its length, and the header of each following element is
+    // written after the data block of the previous one.
+    itoa const first_key{static_cast<std::uint32_t>(first_index)};
+    std::size_t const first_header_size = 1u + first_key.length() + 1u + sizeof(std::int32_t) + 1u;
+    uint8_t* placeholder;
+
+    if (!bson_append_binary_uninit(
+            _impl->back(),
+            first_key.c_str(),
+            static_cast<std::int32_t>(first_key.length()),
+            static_cast<bson_subtype_t>(sub_type),
+            &placeholder,
+            static_cast<std::uint32_t>(size - first_header_size))) {
+        throw bsoncxx::v_noabi::exception{error_code::k_cannot_append_binary};
+    }
+
+    auto const store_le32 = [](std::uint8_t* p, std::uint32_t v) {
+        p[0] = static_cast<std::uint8_t>(v);
+        p[1] = static_cast<std::uint8_t>(v >> 8u);
+        p[2] = static_cast<std::uint8_t>(v >> 16u);
+        p[3] = static_cast<std::uint8_t>(v >> 24u);
+    };
+
+    std::uint8_t* out = placeholder - first_header_size;
+
+    for (std::size_t i = 0u; i < count; ++i) {
+        stdx::string_view const key = _impl->next_key();
+
+        *out++ = static_cast<std::uint8_t>(BSON_TYPE_BINARY);
+        std::memcpy(out, key.data(), key.size());
+        out += key.size();
+        *out++ = 0u;
+        store_le32(out, length);
+        out += sizeof(std::int32_t);
+        *out++ = static_cast<std::uint8_t>(sub_type);
+        binary_data[i] = out;
+        out += length;
+    }
+}
+
 core& core::append(types::b_undefined const&) {
     stdx::string_view key = _impl->next_key();
 
@@ -13,19 +13,57 @@
 // limitations under the License.
 
 #include <bsoncxx/decimal128.hpp>
+
+//
+
+#include <climits>
+#include <cstring>
+
 #include <bsoncxx/exception/error_code.hpp>
 #include <bsoncxx/exception/exception.hpp>
 #include <bsoncxx/stdx/string_view.hpp>
-#include <bsoncxx/string/to_string.hpp>
 
 #include <bsoncxx/private/bson.hh>
 
 namespace bsoncxx {
 namespace v_noabi {
 
+static_assert(
+    decimal128::k_max_string_length + 1u == BSON_DECIMAL128_STRING,
+    "k_max_string_length must match the libbson buffer size (excluding the null terminator)");
+
+constexpr std::size_t decimal128::k_max_string_length;
+
+namespace {
+
+bool parse(stdx::string_view str, bson_decimal128_t* d128) {
+    // An empty string is never a valid representation, and libbson takes the length as an int.
+    if (str.empty() || str.size() > static_cast<std::size_t>(INT_MAX)) {
+        return false;
+    }
+
+    return bson_decimal128_from_string_w_len(str.data(), static_cast<int>(str.size()), d128);
+}
+
+char* format(std::uint64_t high, std::uint64_t low, char* out) {
+    bson_decimal128_t d128;
+    d128.high = high;
+    d128.low = low;
+
+    char str[BSON_DECIMAL128_STRING];
+    bson_decimal128_to_string(&d128, str);
+
+    std::size_t const len = std::strlen(str);
+    std::memcpy(out, str, len);
+
+    return out + len;
+}
+
+} // namespace
+
 decimal128::decimal128(stdx::string_view str) {
     bson_decimal128_t d128;
-    if (!bson_decimal128_from_string(string::to_string(str).c_str(), &d128)) {
+    if (!parse(str, &d128)) {
         throw bsoncxx::v_noabi::exception{error_code::k_invalid_decimal128};
     }
     _high = d128.high;
@@ -33,12 +71,47 @@ decimal128::decimal128(stdx::string_view str) {
 }
 
 std::string decimal128::to_string() const {
+    char str[k_max_string_length];
+    return std::string(str, to_chars(str));
+}
+
+char* decimal128::to_chars(char* out) const {
+    return format(_high, _low, out);
+}
+
+stdx::optional<decimal128> decimal128::from_chars(stdx::string_view str) {
     bson_decimal128_t d128;
-    d128.high = _high;
-    d128.low = _low;
-    char str[BSON_DECIMAL128_STRING];
-    bson_decimal128_to_string(&d128, str);
-    return {str};
+    if (!parse(str, &d128)) {
+        return stdx::nullopt;
+    }
+    return decimal128{d128.high, d128.low};
+}
+
+std::size_t decimal128::from_chars(stdx::string_view const* first, stdx::string_view const* last, decimal128* out) {
+    std::size_t count = 0u;
+
+    for (; first != last; ++first, ++out, ++count) {
+        bson_decimal128_t d128;
+        if (!parse(*first, &d128)) {
+            break;
+        }
+        out->_high = d128.high;
+        out->_low = d128.low;
+    }
+
+    return count;
+}
+
+char* decimal128::to_chars(decimal128 const* first, decimal128 const* last, char* out, char** ends) {
+    for (; first != last; ++first) {
+        out = format(first->_high, first->_low, out);
+
+        if (ends) {
+            *ends++ = out;
+        }
+    }
+
+    return out;
 }
 
 bool operator==(decimal128 const& lhs, decimal128 const& rhs) {
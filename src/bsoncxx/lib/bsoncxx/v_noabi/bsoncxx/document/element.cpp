@@ -18,6 +18,8 @@
 
 #include <bsoncxx/v1/detail/macros.hpp>
 
+#include <chrono>
+#include <cstdint>
 #include <cstdlib>
 #include <string>
 
@@ -28,17 +30,109 @@
 #include <bsoncxx/types/bson_value/view.hpp>
 
 #include <bsoncxx/private/bson.hh>
+#include <bsoncxx/private/raw_element.hh>
 #include <bsoncxx/private/suppress_deprecation_warnings.hh>
 
-#define BSONCXX_CITER                                                           \
-    bson_iter_t iter;                                                           \
-    bson_iter_init_from_data_at_offset(&iter, _raw, _length, _offset, _keylen); \
-    ((void)0)
-
 namespace bsoncxx {
 namespace v_noabi {
 namespace document {
 
+namespace {
+
+// Elements are only ever constructed over bytes libbson has already validated, so the values of
+// fixed-size types, strings, and subdocuments are read directly from the element's bytes rather
+// than re-parsing the element with libbson on every access.
+//
+// The remaining types fall back to `slow`, which decodes the value with libbson.
+
+template <typename Slow>
+auto decode_value(raw_element const&, void const*, Slow const& slow) -> decltype(slow()) {
+    return slow();
+}
+
+template <typename Slow>
+types::b_double decode_value(raw_element const& e, types::b_double const*, Slow const&) {
+    return types::b_double{raw_element::load_double(e.value())};
+}
+
+template <typename Slow>
+types::b_string decode_value(raw_element const& e, types::b_string const*, Slow const&) {
+    // The length prefix includes the trailing NUL.
+    return types::b_string{
+        stdx::string_view{reinterpret_cast<char const*>(e.value() + 4), raw_element::load_uint32(e.value()) - 1u}};
+}
+
+template <typename Slow>
+types::b_document decode_value(raw_element const& e, types::b_document const*, Slow const&) {
+    return types::b_document{document::view{e.value(), raw_element::load_uint32(e.value())}};
+}
+
+template <typename Slow>
+types::b_array decode_value(raw_element const& e, types::b_array const*, Slow const&) {
+    return types::b_array{array::view{e.value(), raw_element::load_uint32(e.value())}};
+}
+
+template <typename Slow>
+types::b_undefined decode_value(raw_element const&, types::b_undefined const*, Slow const&) {
+    return types::b_undefined{};
+}
+
+template <typename Slow>
+types::b_oid decode_value(raw_element const& e, types::b_oid const*, Slow const&) {
+    return types::b_oid{oid{reinterpret_cast<char const*>(e.value()), oid::k_oid_length}};
+}
+
+template <typename Slow>
+types::b_bool decode_value(raw_element const& e, types::b_bool const*, Slow const&) {
+    return types::b_bool{*e.value() != 0u};
+}
+
+template <typename Slow>
+types::b_date decode_value(raw_element const& e, types::b_date const*, Slow const&) {
+    return types::b_date{
+        std::chrono::milliseconds{static_cast<std::int64_t>(raw_element::load_uint64(e.value()))}};
+}
+
+template <typename Slow>
+types::b_null decode_value(raw_element const&, types::b_null const*, Slow const&) {
+    return types::b_null{};
+}
+
+template <typename Slow>
+types::b_int32 decode_value(raw_element const& e, types::b_int32 const*, Slow const&) {
+    return types::b_int32{static_cast<std::int32_t>(raw_element::load_uint32(e.value()))};
+}
+
+template <typename Slow>
+types::b_timestamp decode_value(raw_element const& e, types::b_timestamp const*, Slow const&) {
+    // The increment is stored in the low-order bytes.
+    return types::b_timestamp{raw_element::load_uint32(e.value()), raw_element::load_uint32(e.value() + 4)};
+}
+
+template <typename Slow>
+types::b_int64 decode_value(raw_element const& e, types::b_int64 const*, Slow const&) {
+    return types::b_int64{static_cast<std::int64_t>(raw_element::load_uint64(e.value()))};
+}
+
+template <typename Slow>
+types::b_decimal128 decode_value(raw_element const& e, types::b_decimal128 const*, Slow const&) {
+    // The low-order bits are stored first.
+    return types::b_decimal128{
+        decimal128{raw_element::load_uint64(e.value() + 8), raw_element::load_uint64(e.value())}};
+}
+
+template <typename Slow>
+types::b_maxkey decode_value(raw_element const&, types::b_maxkey const*, Slow const&) {
+    return types::b_maxkey{};
+}
+
+template <typename Slow>
+types::b_minkey decode_value(raw_element const&, types::b_minkey const*, Slow const&) {
+    return types::b_minkey{};
+}
+
+} // namespace
+
 element::element() : element(nullptr, 0, 0, 0) {}
 
 element::element(std::uint8_t const* raw, std::uint32_t length, std::uint32_t offset, std::uint32_t keylen)
@@ -69,8 +163,7 @@ bsoncxx::v_noabi::type element::type() const {
                 std::string(_key ? " with key \"" + std::string(_key.value().data()) + "\"" : "")};
     }
 
-    BSONCXX_CITER;
-    return static_cast<bsoncxx::v_noabi::type>(bson_iter_type(&iter));
+    return raw_element{_raw, _offset, _keylen}.type();
 }
 
 stdx::string_view element::key() const {
@@ -81,11 +174,7 @@ stdx::string_view element::key() const {
                 std::string(_key ? " with key \"" + std::string(_key.value().data()) + "\"" : "")};
     }
 
-    BSONCXX_CITER;
-
-    char const* key = bson_iter_key(&iter);
-
-    return stdx::string_view{key};
+    return raw_element{_raw, _offset, _keylen}.key();
 }
 
 #define BSONCXX_ENUM(name, val)                                                                         \
@@ -96,8 +185,16 @@ stdx::string_view element::key() const {
                 "cannot get " #name " from an uninitialized element" +                                  \
                     std::string(_key ? " with key \"" + std::string(_key.value().data()) + "\"" : "")}; \
         }                                                                                               \
-        types::bson_value::view v{_raw, _length, _offset, _keylen};                                     \
-        return v.get_##name();                                                                          \
+                                                                                                        \
+        raw_element const e{_raw, _offset, _keylen};                                                    \
+                                                                                                        \
+        if (e.type() != bsoncxx::v_noabi::type::k_##name) {                                             \
+            throw bsoncxx::v_noabi::exception{error_code::k_need_element_type_k_##name};                \
+        }                                                                                               \
+                                                                                                        \
+        return decode_value(e, static_cast<types::b_##name const*>(nullptr), [this] {                   \
+            return types::bson_value::view{_raw, _length, _offset, _keylen}.get_##name();               \
+        });                                                                                             \
     }
 #include <bsoncxx/enums/type.hpp>
 #undef BSONCXX_ENUM
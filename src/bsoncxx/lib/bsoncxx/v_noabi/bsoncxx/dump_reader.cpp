@@ -0,0 +1,345 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/dump_reader.hpp>
+
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <bsoncxx/exception/error_code.hpp>
+#include <bsoncxx/exception/exception.hpp>
+#include <bsoncxx/validate.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+namespace bsoncxx {
+namespace v_noabi {
+
+namespace {
+
+[[noreturn]] void throw_cannot_map(std::string const& path, std::error_code const& ec) {
+    throw exception{error_code::k_cannot_map_file, path + ": " + ec.message()};
+}
+
+// Owns a read-only mapping of an entire file. An empty file has no mapping.
+class mapped_file {
+   public:
+    explicit mapped_file(std::string const& path) {
+#if defined(_WIN32)
+        _file = ::CreateFileA(
+            path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+        if (_file == INVALID_HANDLE_VALUE) {
+            throw_cannot_map(path, std::error_code{static_cast<int>(::GetLastError()), std::system_category()});
+        }
+
+        LARGE_INTEGER size;
+
+        if (!::GetFileSizeEx(_file, &size) || static_cast<unsigned long long>(size.QuadPart) > SIZE_MAX) {
+            auto const ec = std::error_code{static_cast<int>(::GetLastError()), std::system_category()};
+            ::CloseHandle(_file);
+            throw_cannot_map(path, ec);
+        }
+
+        _length = static_cast<std::size_t>(size.QuadPart);
+
+        if (_length == 0u) {
+            return;
+        }
+
+        _mapping = ::CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        void* const view = _mapping ? ::MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+        if (!view) {
+            auto const ec = std::error_code{static_cast<int>(::GetLastError()), std::system_category()};
+            if (_mapping) {
+                ::CloseHandle(_mapping);
+            }
+            ::CloseHandle(_file);
+            throw_cannot_map(path, ec);
+        }
+
+        _data = static_cast<std::uint8_t const*>(view);
+#else
+        int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd < 0) {
+            throw_cannot_map(path, std::error_code{errno, std::generic_category()});
+        }
+
+        struct stat st;
+
+        if (::fstat(fd, &st) != 0) {
+            auto const ec = std::error_code{errno, std::generic_category()};
+            ::close(fd);
+            throw_cannot_map(path, ec);
+        }
+
+        // Only regular files can be mapped.
+        if (!S_ISREG(st.st_mode)) {
+            ::close(fd);
+            throw_cannot_map(path, std::make_error_code(std::errc::invalid_argument));
+        }
+
+        _length = static_cast<std::size_t>(st.st_size);
+
+        if (_length == 0u) {
+            ::close(fd);
+            return;
+        }
+
+        void* const view = ::mmap(nullptr, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+        auto const ec = std::error_code{errno, std::generic_category()};
+
+        // The mapping remains valid after the descriptor is closed.
+        ::close(fd);
+
+        if (view == MAP_FAILED) {
+            throw_cannot_map(path, ec);
+        }
+
+        // Dumps are usually processed from start to end. This is only a hint, so failure is ignored.
+        (void)::madvise(view, _length, MADV_SEQUENTIAL);
+
+        _data = static_cast<std::uint8_t const*>(view);
+#endif
+    }
+
+    ~mapped_file() {
+#if defined(_WIN32)
+        if (_data) {
+            ::UnmapViewOfFile(_data);
+        }
+
+        if (_mapping) {
+            ::CloseHandle(_mapping);
+        }
+
+        ::CloseHandle(_file);
+#else
+        if (_data) {
+            ::munmap(const_cast<std::uint8_t*>(_data), _length);
+        }
+#endif
+    }
+
+    mapped_file(mapped_file&&) = delete;
+    mapped_file& operator=(mapped_file&&) = delete;
+    mapped_file(mapped_file const&) = delete;
+    mapped_file& operator=(mapped_file const&) = delete;
+
+    std::uint8_t const* data() const {
+        return _data;
+    }
+
+    std::size_t length() const {
+        return _length;
+    }
+
+   private:
+    std::uint8_t const* _data = nullptr;
+    std::size_t _length = 0u;
+
+#if defined(_WIN32)
+    HANDLE _file = INVALID_HANDLE_VALUE;
+    HANDLE _mapping = nullptr;
+#endif
+};
+
+std::uint32_t load_le32(std::uint8_t const* p) {
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8u) |
+           (static_cast<std::uint32_t>(p[2]) << 16u) | (static_cast<std::uint32_t>(p[3]) << 24u);
+}
+
+} // namespace
+
+class dump_reader::impl {
+   public:
+    explicit impl(stdx::string_view path) : _file{std::string{path.data(), path.size()}} {
+        std::uint8_t const* const data = _file.data();
+        std::size_t const length = _file.length();
+        std::size_t offset = 0u;
+
+        // The smallest document is its length prefix and terminator.
+        while (length - offset >= 5u) {
+            std::size_t const document_length = load_le32(data + offset);
+
+            if (document_length < 5u || document_length > length - offset) {
+                break;
+            }
+
+            if (data[offset + document_length - 1u] != 0u) {
+                break;
+            }
+
+            _documents.emplace_back(data + offset, document_length);
+            offset += document_length;
+        }
+
+        _indexed_length = offset;
+    }
+
+    mapped_file _file;
+    std::vector<document::view> _documents;
+    std::size_t _indexed_length = 0u;
+};
+
+dump_reader::dump_reader(stdx::string_view path) : _impl{make_unique<impl>(path)} {}
+
+dump_reader::dump_reader(dump_reader&&) noexcept = default;
+
+dump_reader& dump_reader::operator=(dump_reader&&) noexcept = default;
+
+dump_reader::~dump_reader() = default;
+
+std::uint8_t const* dump_reader::data() const {
+    return _impl->_file.data();
+}
+
+std::size_t dump_reader::length() const {
+    return _impl->_file.length();
+}
+
+std::size_t dump_reader::indexed_length() const {
+    return _impl->_indexed_length;
+}
+
+std::size_t dump_reader::size() const {
+    return _impl->_documents.size();
+}
+
+bool dump_reader::empty() const {
+    return _impl->_documents.empty();
+}
+
+document::view dump_reader::operator[](std::size_t index) const {
+    return _impl->_documents[index];
+}
+
+dump_reader::const_iterator dump_reader::begin() const {
+    return _impl->_documents.data();
+}
+
+dump_reader::const_iterator dump_reader::end() const {
+    return _impl->_documents.data() + _impl->_documents.size();
+}
+
+bool dump_reader::validate(validator const& validator, std::size_t* invalid_offset, std::size_t thread_count) const {
+    auto const& documents = _impl->_documents;
+    std::uint8_t const* const data = _impl->_file.data();
+
+    if (thread_count == 0u) {
+        thread_count = (std::max)(1u, std::thread::hardware_concurrency());
+    }
+
+    thread_count = (std::min)(thread_count, documents.size());
+
+    // The index of the first invalid document found so far. Threads stop once every document
+    // before this one in their range has been checked.
+    std::atomic<std::size_t> first_invalid{documents.size()};
+
+    auto const validate_range = [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last && i < first_invalid.load(std::memory_order_relaxed); ++i) {
+            if (!v_noabi::validate(documents[i].data(), documents[i].length(), validator)) {
+                std::size_t current = first_invalid.load();
+                while (i < current && !first_invalid.compare_exchange_weak(current, i)) {
+                }
+                return;
+            }
+        }
+    };
+
+    if (thread_count <= 1u) {
+        validate_range(0u, documents.size());
+    } else {
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count - 1u);
+
+        auto const join_all = [&threads] {
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        };
+
+        try {
+            std::size_t first = 0u;
+
+            // Split the documents into ranges of roughly equal size in bytes. The last range is
+            // validated by the calling thread.
+            for (std::size_t k = 1u; k <= thread_count; ++k) {
+                std::size_t last = documents.size();
+
+                if (k < thread_count) {
+                    std::size_t const target = _impl->_indexed_length / thread_count * k;
+
+                    last = static_cast<std::size_t>(
+                        std::lower_bound(
+                            documents.begin() + static_cast<std::ptrdiff_t>(first),
+                            documents.end(),
+                            target,
+                            [data](document::view const& doc, std::size_t offset) {
+                                return static_cast<std::size_t>(doc.data() - data) < offset;
+                            }) -
+                        documents.begin());
+
+                    threads.emplace_back(validate_range, first, last);
+                } else {
+                    validate_range(first, last);
+                }
+
+                first = last;
+            }
+        } catch (...) {
+            join_all();
+            throw;
+        }
+
+        join_all();
+    }
+
+    std::size_t const index = first_invalid.load();
+
+    if (index == documents.size()) {
+        return true;
+    }
+
+    if (invalid_offset) {
+        std::size_t offset = 0u;
+        (void)v_noabi::validate(documents[index].data(), documents[index].length(), validator, &offset);
+        *invalid_offset = static_cast<std::size_t>(documents[index].data() - data) + offset;
+    }
+
+    return false;
+}
+
+} // namespace v_noabi
+} // namespace bsoncxx
@@ -0,0 +1,373 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/dump_writer.hpp>
+
+//
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <bsoncxx/exception/error_code.hpp>
+#include <bsoncxx/exception/exception.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+namespace bsoncxx {
+namespace v_noabi {
+
+namespace {
+
+constexpr std::size_t k_page_size = 4096u;
+
+struct span {
+    std::uint8_t const* data;
+    std::size_t size;
+};
+
+// Writes every byte of the given pieces in order. Returns an error code on failure.
+std::error_code write_fully(int fd, span* pieces, std::size_t count) {
+    while (count > 0u) {
+        if (pieces->size == 0u) {
+            ++pieces;
+            --count;
+            continue;
+        }
+
+#if defined(_WIN32)
+        int const n = ::_write(fd, pieces->data, static_cast<unsigned>(std::min<std::size_t>(pieces->size, INT_MAX)));
+#else
+        iovec iov[2];
+        int const iov_count = static_cast<int>(std::min<std::size_t>(count, 2u));
+
+        for (int i = 0; i < iov_count; ++i) {
+            iov[i].iov_base = const_cast<std::uint8_t*>(pieces[i].data);
+            iov[i].iov_len = pieces[i].size;
+        }
+
+        ssize_t const n = ::writev(fd, iov, iov_count);
+#endif
+
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            return std::error_code{errno, std::generic_category()};
+        }
+
+        // Advance past the written bytes, which may end partway through a piece.
+        auto written = static_cast<std::size_t>(n);
+
+        while (count > 0u && written >= pieces->size) {
+            written -= pieces->size;
+            ++pieces;
+            --count;
+        }
+
+        if (count > 0u) {
+            pieces->data += written;
+            pieces->size -= written;
+        }
+    }
+
+    return {};
+}
+
+[[noreturn]] void throw_cannot_write(std::error_code const& ec) {
+    throw exception{error_code::k_cannot_write_file, ec.message()};
+}
+
+int open_for_writing(stdx::string_view path) {
+    std::string const filename{path.data(), path.size()};
+
+#if defined(_WIN32)
+    int const fd = ::_open(filename.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    int const fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+#endif
+
+    if (fd < 0) {
+        auto const ec = std::error_code{errno, std::generic_category()};
+        throw exception{error_code::k_cannot_write_file, filename + ": " + ec.message()};
+    }
+
+    return fd;
+}
+
+void close_fd(int fd) {
+#if defined(_WIN32)
+    ::_close(fd);
+#else
+    ::close(fd);
+#endif
+}
+
+// A page-aligned buffer of a fixed capacity.
+class buffer {
+   public:
+    explicit buffer(std::size_t capacity)
+        : _storage{new std::uint8_t[capacity + k_page_size]},
+          _data{_storage.get() + (k_page_size - reinterpret_cast<std::uintptr_t>(_storage.get()) % k_page_size)} {}
+
+    std::uint8_t* data() {
+        return _data;
+    }
+
+   private:
+    std::unique_ptr<std::uint8_t[]> _storage;
+    std::uint8_t* _data;
+};
+
+} // namespace
+
+class dump_writer::impl {
+   public:
+    impl(int fd, bool owns_fd, std::size_t buffer_size, bool background)
+        : _fd{fd},
+          _owns_fd{owns_fd},
+          _capacity{std::max(k_page_size, (buffer_size + k_page_size - 1u) / k_page_size * k_page_size)},
+          _current{make_unique<buffer>(_capacity)} {
+        if (background) {
+            _spare = make_unique<buffer>(_capacity);
+            _thread = std::thread{[this] { this->run(); }};
+        }
+    }
+
+    ~impl() {
+        try {
+            flush();
+        } catch (...) {
+            // Errors are reported only by an explicit flush().
+        }
+
+        if (_thread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _stopping = true;
+            }
+
+            _cv.notify_all();
+            _thread.join();
+        }
+
+        if (_owns_fd) {
+            close_fd(_fd);
+        }
+    }
+
+    impl(impl&&) = delete;
+    impl& operator=(impl&&) = delete;
+    impl(impl const&) = delete;
+    impl& operator=(impl const&) = delete;
+
+    void write(document::view doc) {
+        std::size_t const length = doc.length();
+
+        if (length <= _capacity - _used) {
+            std::memcpy(_current->data() + _used, doc.data(), length);
+            _used += length;
+        } else if (length < _capacity) {
+            submit();
+            std::memcpy(_current->data(), doc.data(), length);
+            _used = length;
+        } else {
+            // Too large to buffer: write the pending buffer and the document together.
+            wait_idle();
+
+            span pieces[] = {{_current->data(), _used}, {doc.data(), length}};
+            _used = 0u;
+
+            if (auto const ec = write_fully(_fd, pieces, 2u)) {
+                throw_cannot_write(ec);
+            }
+        }
+
+        ++_documents;
+        _bytes += length;
+    }
+
+    void flush() {
+        submit();
+        wait_idle();
+    }
+
+    int _fd;
+    bool _owns_fd;
+    std::size_t _capacity;
+
+    // The buffer being filled by the caller.
+    std::unique_ptr<buffer> _current;
+    std::size_t _used = 0u;
+
+    std::size_t _documents = 0u;
+    std::uint64_t _bytes = 0u;
+
+    // Background flushing: the buffer not being filled is either spare or pending.
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::unique_ptr<buffer> _spare;
+    std::unique_ptr<buffer> _pending;
+    std::size_t _pending_used = 0u;
+    std::error_code _error;
+    bool _stopping = false;
+
+   private:
+    // Writes the current buffer, or hands it to the background thread.
+    void submit() {
+        if (_used == 0u) {
+            check_error();
+            return;
+        }
+
+        if (!_thread.joinable()) {
+            span piece{_current->data(), _used};
+            _used = 0u;
+
+            if (auto const ec = write_fully(_fd, &piece, 1u)) {
+                throw_cannot_write(ec);
+            }
+
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock{_mutex};
+        _cv.wait(lock, [this] { return _spare != nullptr; });
+
+        if (_error) {
+            lock.unlock();
+            check_error();
+        }
+
+        _pending = std::move(_current);
+        _pending_used = _used;
+        _current = std::move(_spare);
+        _used = 0u;
+
+        lock.unlock();
+        _cv.notify_all();
+    }
+
+    // Waits until the background thread has written every submitted buffer.
+    void wait_idle() {
+        if (_thread.joinable()) {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _cv.wait(lock, [this] { return _spare != nullptr; });
+        }
+
+        check_error();
+    }
+
+    void check_error() {
+        if (!_thread.joinable()) {
+            return;
+        }
+
+        std::error_code ec;
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            std::swap(ec, _error);
+        }
+
+        if (ec) {
+            throw_cannot_write(ec);
+        }
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock{_mutex};
+
+        for (;;) {
+            _cv.wait(lock, [this] { return _pending != nullptr || _stopping; });
+
+            if (!_pending) {
+                return;
+            }
+
+            span piece{_pending->data(), _pending_used};
+
+            lock.unlock();
+            auto const ec = write_fully(_fd, &piece, 1u);
+            lock.lock();
+
+            if (ec && !_error) {
+                _error = ec;
+            }
+
+            _spare = std::move(_pending);
+            _cv.notify_all();
+        }
+    }
+};
+
+constexpr std::size_t dump_writer::k_default_buffer_size;
+
+dump_writer::dump_writer(stdx::string_view path, std::size_t buffer_size, bool background) {
+    int const fd = open_for_writing(path);
+
+    try {
+        _impl = make_unique<impl>(fd, true, buffer_size, background);
+    } catch (...) {
+        close_fd(fd);
+        throw;
+    }
+}
+
+dump_writer::dump_writer(int fd, std::size_t buffer_size, bool background)
+    : _impl{make_unique<impl>(fd, false, buffer_size, background)} {}
+
+dump_writer::dump_writer(dump_writer&&) noexcept = default;
+
+dump_writer& dump_writer::operator=(dump_writer&&) noexcept = default;
+
+dump_writer::~dump_writer() = default;
+
+dump_writer& dump_writer::write(document::view doc) {
+    _impl->write(doc);
+    return *this;
+}
+
+void dump_writer::flush() {
+    _impl->flush();
+}
+
+std::size_t dump_writer::documents_written() const {
+    return _impl->_documents;
+}
+
+std::uint64_t dump_writer::bytes_written() const {
+    return _impl->_bytes;
+}
+
+} // namespace v_noabi
+} // namespace bsoncxx
@@ -87,6 +87,12 @@ class error_category_impl final : public std::error_category {
                 return "BSON vector too large";
             case error_code::k_vector_out_of_range:
                 return "BSON vector access out of range";
+            case error_code::k_vector_size_mismatch:
+                return "BSON vectors have different sizes";
+            case error_code::k_cannot_map_file:
+                return "unable to open or map file";
+            case error_code::k_cannot_write_file:
+                return "unable to write file";
             default:
                 return "unknown bsoncxx error code";
         }
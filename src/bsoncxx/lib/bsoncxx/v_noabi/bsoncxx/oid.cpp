@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
 #include <cstring>
 
 #include <bsoncxx/exception/error_code.hpp>
@@ -19,24 +20,79 @@
 #include <bsoncxx/oid.hpp>
 
 #include <bsoncxx/private/bson.hh>
+#include <bsoncxx/private/simd.hh>
 
 namespace bsoncxx {
 namespace v_noabi {
 
+constexpr std::size_t oid::k_oid_string_length;
+
+namespace {
+
+// Owns the calling thread's OID generation context. Each context has its own counter and
+// process-unique random value, so threads never contend on (or share a cache line for) the
+// counter of libbson's default context.
+class thread_context {
+   public:
+    ~thread_context() {
+        bson_context_destroy(_context);
+    }
+
+    thread_context(thread_context&&) = delete;
+    thread_context& operator=(thread_context&&) = delete;
+    thread_context(thread_context const&) = delete;
+    thread_context& operator=(thread_context const&) = delete;
+
+    // Like the default context, check the process ID so a forked child does not reuse the parent's
+    // process-unique value.
+    thread_context() : _context(bson_context_new(BSON_CONTEXT_DISABLE_PID_CACHE)) {}
+
+    bson_context_t* get() const {
+        return _context;
+    }
+
+   private:
+    bson_context_t* _context;
+};
+
+bson_context_t* get_thread_context() {
+    static thread_local thread_context context;
+    return context.get();
+}
+
+// Maps an ASCII character to its hexadecimal digit value, or to 0xFF if it is not a hex digit.
+std::uint8_t hex_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return static_cast<std::uint8_t>(c - '0');
+    }
+
+    // Fold ASCII letters to lowercase.
+    char const lower = static_cast<char>(c | 0x20);
+
+    if (lower >= 'a' && lower <= 'f') {
+        return static_cast<std::uint8_t>(lower - 'a' + 10);
+    }
+
+    return 0xFFu;
+}
+
+} // namespace
+
 oid::oid() {
     bson_oid_t oid;
-    bson_oid_init(&oid, nullptr);
+    bson_oid_init(&oid, get_thread_context());
 
     std::memcpy(_bytes.data(), oid.bytes, sizeof(oid.bytes));
 }
 
 oid::oid(stdx::string_view const& str) {
-    if (!bson_oid_is_valid(str.data(), str.size())) {
+    auto const parsed = from_chars(str);
+
+    if (!parsed) {
         throw bsoncxx::v_noabi::exception{error_code::k_invalid_oid};
     }
-    bson_oid_t oid;
-    bson_oid_init_from_string(&oid, str.data());
-    memcpy(_bytes.data(), oid.bytes, _bytes.size());
+
+    _bytes = parsed->_bytes;
 }
 
 oid::oid(char const* bytes, std::size_t len) {
@@ -47,13 +103,70 @@ oid::oid(char const* bytes, std::size_t len) {
 }
 
 std::string oid::to_string() const {
-    bson_oid_t oid;
-    std::memcpy(oid.bytes, _bytes.data(), sizeof(oid.bytes));
-    char str[25];
+    char str[k_oid_string_length];
+
+    return std::string(str, to_chars(str));
+}
+
+char* oid::to_chars(char* out) const {
+#if BSONCXX_PRIVATE_SIMD_SSE2
+    // Split each byte into its two nibbles, interleave them (high nibble first), and map each
+    // nibble n to '0' + n, plus the distance from '9' + 1 to 'a' when n > 9.
+    unsigned char buf[16] = {};
+    std::memcpy(buf, _bytes.data(), _bytes.size());
+
+    __m128i const bytes = _mm_loadu_si128(reinterpret_cast<__m128i const*>(buf));
+    __m128i const mask = _mm_set1_epi8(0x0F);
+
+    __m128i const hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+    __m128i const lo = _mm_and_si128(bytes, mask);
+
+    auto const to_hex = [](__m128i nibbles) {
+        __m128i const letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '9' - 1));
+        return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+    };
+
+    unsigned char chars[32];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(chars), to_hex(_mm_unpacklo_epi8(hi, lo)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(chars + 16), to_hex(_mm_unpackhi_epi8(hi, lo)));
+
+    std::memcpy(out, chars, k_oid_string_length);
+#else
+    static constexpr char k_digits[] = "0123456789abcdef";
+
+    for (std::size_t i = 0u; i < _bytes.size(); ++i) {
+        auto const b = static_cast<unsigned char>(_bytes[i]);
+        out[2u * i] = k_digits[b >> 4u];
+        out[2u * i + 1u] = k_digits[b & 0x0Fu];
+    }
+#endif
+
+    return out + k_oid_string_length;
+}
+
+stdx::optional<oid> oid::from_chars(stdx::string_view str) {
+    if (str.size() != k_oid_string_length) {
+        return stdx::nullopt;
+    }
+
+    char bytes[k_oid_length];
 
-    bson_oid_to_string(&oid, str);
+    // Accumulate invalid digits rather than branching on each one.
+    std::uint8_t invalid = 0u;
+
+    for (std::size_t i = 0u; i < k_oid_length; ++i) {
+        std::uint8_t const hi = hex_value(str[2u * i]);
+        std::uint8_t const lo = hex_value(str[2u * i + 1u]);
+
+        invalid |= static_cast<std::uint8_t>(hi | lo);
+        bytes[i] = static_cast<char>((hi << 4u) | (lo & 0x0Fu));
+    }
+
+    if ((invalid & 0xF0u) != 0u) {
+        return stdx::nullopt;
+    }
 
-    return std::string(str);
+    return oid{bytes, k_oid_length};
 }
 
 std::time_t oid::get_time_t() const {
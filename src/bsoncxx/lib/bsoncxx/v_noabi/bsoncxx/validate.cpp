@@ -14,12 +14,391 @@
 
 #include <bsoncxx/validate.hpp>
 
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include <bsoncxx/private/bson.hh>
+#include <bsoncxx/private/itoa.hh>
 #include <bsoncxx/private/make_unique.hh>
+#include <bsoncxx/private/simd.hh>
 
 namespace bsoncxx {
 namespace v_noabi {
 
+namespace {
+
+std::uint32_t load_uint32(std::uint8_t const* p) {
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return BSON_UINT32_FROM_LE(v);
+}
+
+// Returns the length of the longest prefix of `s` consisting only of ASCII bytes (excluding NUL
+// unless `allow_null` is true), examining 16 bytes at a time with SSE2 or 8 bytes at a time
+// otherwise.
+std::size_t ascii_prefix(std::uint8_t const* s, std::size_t n, bool allow_null) {
+    std::size_t i = 0u;
+
+#if BSONCXX_PRIVATE_SIMD_SSE2
+    __m128i const zero = _mm_setzero_si128();
+
+    for (; i + 16u <= n; i += 16u) {
+        __m128i const chunk = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + i));
+
+        int mask = _mm_movemask_epi8(chunk);
+
+        if (!allow_null) {
+            mask |= _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero));
+        }
+
+        if (mask != 0) {
+            break;
+        }
+    }
+#else
+    std::uint64_t const lo = 0x0101010101010101u;
+    std::uint64_t const hi = 0x8080808080808080u;
+
+    for (; i + 8u <= n; i += 8u) {
+        std::uint64_t w;
+        std::memcpy(&w, s + i, sizeof(w));
+
+        std::uint64_t mask = w & hi;
+
+        if (!allow_null) {
+            mask |= (w - lo) & ~w & hi;
+        }
+
+        if (mask != 0u) {
+            break;
+        }
+    }
+#endif
+
+    // Locate the offending byte (if any) in the remaining tail.
+    for (; i < n; ++i) {
+        if ((s[i] & 0x80u) != 0u || (!allow_null && s[i] == 0u)) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+// Strict UTF-8 validation: rejects overlong encodings, surrogates, and code points above U+10FFFF.
+bool is_valid_utf8(std::uint8_t const* s, std::size_t n, bool allow_null) {
+    std::size_t i = 0u;
+
+    for (;;) {
+        i += ascii_prefix(s + i, n - i, allow_null);
+
+        if (i == n) {
+            return true;
+        }
+
+        std::uint8_t const c = s[i];
+
+        // Bounds of the second byte of the sequence, and the number of continuation bytes.
+        std::uint8_t lo = 0x80u;
+        std::uint8_t hi = 0xBFu;
+        std::size_t count = 0u;
+
+        if (c >= 0xC2u && c <= 0xDFu) {
+            count = 1u;
+        } else if (c >= 0xE0u && c <= 0xEFu) {
+            count = 2u;
+            lo = c == 0xE0u ? 0xA0u : lo;
+            hi = c == 0xEDu ? 0x9Fu : hi;
+        } else if (c >= 0xF0u && c <= 0xF4u) {
+            count = 3u;
+            lo = c == 0xF0u ? 0x90u : lo;
+            hi = c == 0xF4u ? 0x8Fu : hi;
+        } else {
+            // NUL (when not allowed), a stray continuation byte, or an invalid lead byte.
+            return false;
+        }
+
+        if (n - i <= count || s[i + 1u] < lo || s[i + 1u] > hi) {
+            return false;
+        }
+
+        for (std::size_t j = 2u; j <= count; ++j) {
+            if ((s[i + j] & 0xC0u) != 0x80u) {
+                return false;
+            }
+        }
+
+        i += count + 1u;
+    }
+}
+
+// A strict, single-pass BSON validator which accepts a document only if it is certain that
+// `bson_validate` would also accept it with the equivalent flags.
+//
+// Anything it is unsure about (keys starting with '$' or containing '.' when those are checked,
+// code with scope, deprecated binary subtype 2, lenient UTF-8, deep nesting, ...) is rejected, in
+// which case the caller defers to libbson, which is the authority on validity and on the offset of
+// the error. Valid documents, the common case, are therefore only traversed once.
+class fast_validator {
+   public:
+    explicit fast_validator(validator const& v)
+        : _check_utf8(v.check_utf8() || v.check_utf8_allow_null()),
+          _allow_null(v.check_utf8_allow_null()),
+          _check_dollar_keys(v.check_dollar_keys()),
+          _check_dot_keys(v.check_dot_keys()) {}
+
+    bool document(std::uint8_t const* data, std::size_t length) const {
+        if (length < 5u || length > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max())) {
+            return false;
+        }
+
+        auto const len = static_cast<std::uint32_t>(length);
+
+        return load_uint32(data) == len && elements(data, len, 0, false);
+    }
+
+   private:
+    static constexpr int k_max_depth = 100;
+
+    bool is_valid_string(std::uint8_t const* s, std::size_t n) const {
+        if (_check_utf8) {
+            return is_valid_utf8(s, n, _allow_null);
+        }
+
+        return std::memchr(s, 0, n) == nullptr;
+    }
+
+    // Validates a length-prefixed string value of at most `avail` bytes, storing its total size.
+    bool string_value(std::uint8_t const* v, std::uint32_t avail, std::uint32_t* size) const {
+        if (avail < 4u) {
+            return false;
+        }
+
+        std::uint32_t const n = load_uint32(v);
+
+        if (n < 1u || n > avail - 4u || v[4u + n - 1u] != 0u || !is_valid_string(v + 4, n - 1u)) {
+            return false;
+        }
+
+        *size = 4u + n;
+        return true;
+    }
+
+    bool key(std::uint8_t const* k, std::size_t n, std::uint32_t index, bool is_array) const {
+        if (is_array) {
+            itoa const expected{index};
+            return n == expected.length() && std::memcmp(k, expected.c_str(), n) == 0;
+        }
+
+        if (_check_dollar_keys && n > 0u && k[0] == '$') {
+            return false;
+        }
+
+        if (_check_dot_keys && std::memchr(k, '.', n) != nullptr) {
+            return false;
+        }
+
+        return is_valid_utf8(k, n, false);
+    }
+
+    // `doc` points at `len` bytes whose length prefix has already been checked against its bounds.
+    bool elements(std::uint8_t const* doc, std::uint32_t len, int depth, bool is_array) const {
+        if (doc[len - 1u] != 0u) {
+            return false;
+        }
+
+        std::uint32_t const end = len - 1u;
+        std::uint32_t pos = 4u;
+        std::uint32_t index = 0u;
+
+        while (pos < end) {
+            std::uint8_t const type = doc[pos];
+
+            auto const k = doc + pos + 1u;
+            auto const k_end = static_cast<std::uint8_t const*>(std::memchr(k, 0, end - (pos + 1u)));
+
+            if (!k_end || !key(k, static_cast<std::size_t>(k_end - k), index++, is_array)) {
+                return false;
+            }
+
+            std::uint32_t const off = static_cast<std::uint32_t>(k_end - doc) + 1u;
+            std::uint32_t const avail = end - off;
+            std::uint8_t const* const v = doc + off;
+            std::uint32_t size = 0u;
+
+            switch (type) {
+                case BSON_TYPE_UNDEFINED:
+                case BSON_TYPE_NULL:
+                case BSON_TYPE_MAXKEY:
+                case BSON_TYPE_MINKEY:
+                    break;
+
+                case BSON_TYPE_BOOL:
+                    if (avail < 1u || v[0] > 1u) {
+                        return false;
+                    }
+                    size = 1u;
+                    break;
+
+                case BSON_TYPE_INT32:
+                    size = 4u;
+                    break;
+
+                case BSON_TYPE_DOUBLE:
+                case BSON_TYPE_DATE_TIME:
+                case BSON_TYPE_TIMESTAMP:
+                case BSON_TYPE_INT64:
+                    size = 8u;
+                    break;
+
+                case BSON_TYPE_OID:
+                    size = 12u;
+                    break;
+
+                case BSON_TYPE_DECIMAL128:
+                    size = 16u;
+                    break;
+
+                case BSON_TYPE_UTF8:
+                case BSON_TYPE_CODE:
+                case BSON_TYPE_SYMBOL:
+                    if (!string_value(v, avail, &size)) {
+                        return false;
+                    }
+                    break;
+
+                case BSON_TYPE_DOCUMENT:
+                case BSON_TYPE_ARRAY: {
+                    if (avail < 5u || depth + 1 >= k_max_depth) {
+                        return false;
+                    }
+
+                    size = load_uint32(v);
+
+                    if (size < 5u || size > avail || !elements(v, size, depth + 1, type == BSON_TYPE_ARRAY)) {
+                        return false;
+                    }
+                    break;
+                }
+
+                case BSON_TYPE_BINARY: {
+                    if (avail < 5u) {
+                        return false;
+                    }
+
+                    std::uint32_t const n = load_uint32(v);
+
+                    // The deprecated subtype 2 embeds a second length which libbson also checks.
+                    if (n > avail - 5u || v[4] == BSON_SUBTYPE_BINARY_DEPRECATED) {
+                        return false;
+                    }
+
+                    size = 5u + n;
+                    break;
+                }
+
+                case BSON_TYPE_REGEX: {
+                    // The pattern and options are consecutive cstrings.
+                    auto const pattern_end = static_cast<std::uint8_t const*>(std::memchr(v, 0, avail));
+
+                    if (!pattern_end) {
+                        return false;
+                    }
+
+                    auto const options = pattern_end + 1;
+                    auto const options_end = static_cast<std::uint8_t const*>(
+                        std::memchr(options, 0, avail - static_cast<std::uint32_t>(options - v)));
+
+                    if (!options_end || !is_valid_utf8(v, static_cast<std::size_t>(pattern_end - v), false) ||
+                        !is_valid_utf8(options, static_cast<std::size_t>(options_end - options), false)) {
+                        return false;
+                    }
+
+                    size = static_cast<std::uint32_t>(options_end - v) + 1u;
+                    break;
+                }
+
+                case BSON_TYPE_DBPOINTER:
+                    if (!string_value(v, avail, &size) || avail - size < 12u) {
+                        return false;
+                    }
+                    size += 12u;
+                    break;
+
+                // Code with scope, EOD in the middle of a document, and unknown types.
+                default:
+                    return false;
+            }
+
+            if (size > avail) {
+                return false;
+            }
+
+            pos = off + size;
+        }
+
+        return true;
+    }
+
+    bool _check_utf8;
+    bool _allow_null;
+    bool _check_dollar_keys;
+    bool _check_dot_keys;
+};
+
+constexpr int fast_validator::k_max_depth;
+
+::bson_validate_flags_t to_validate_flags(validator const& validator) {
+    ::bson_validate_flags_t flags = BSON_VALIDATE_NONE;
+
+    auto const flip_if = [&flags](bool cond, ::bson_validate_flags_t flag) {
+        if (cond) {
+            // this static cast needed to get around invalid conversion warnings...
+            flags = static_cast<::bson_validate_flags_t>(flags | flag);
+        }
+    };
+
+    flip_if(validator.check_dot_keys(), BSON_VALIDATE_DOT_KEYS);
+    flip_if(validator.check_dollar_keys(), BSON_VALIDATE_DOLLAR_KEYS);
+    // we enable VALIDATE_UTF8 if the user wants VALIDATE_UTF8_ALLOW_NULL
+    // otherwise validate_utf8_allow_null() would do nothing due to how libbson
+    // interprets the flag.
+    flip_if((validator.check_utf8() || validator.check_utf8_allow_null()), BSON_VALIDATE_UTF8);
+    flip_if(validator.check_utf8_allow_null(), BSON_VALIDATE_UTF8_ALLOW_NULL);
+
+    return flags;
+}
+
+bool validate_document(
+    std::uint8_t const* data,
+    std::size_t length,
+    fast_validator const& fast,
+    ::bson_validate_flags_t flags,
+    std::size_t* invalid_offset) {
+    if (fast.document(data, length)) {
+        return true;
+    }
+
+    ::bson_t bson;
+    if (!::bson_init_static(&bson, data, length)) {
+        // if we can't even initialize a bson_t we just say the error is at offset 0.
+        if (invalid_offset) {
+            *invalid_offset = 0u;
+        }
+        return false;
+    }
+
+    return ::bson_validate(&bson, flags, invalid_offset);
+}
+
+} // namespace
+
 struct validator::impl {
     bool _check_utf8{false};
     bool _check_utf8_allow_null{false};
@@ -70,37 +449,51 @@ stdx::optional<document::view> validate(std::uint8_t const* data, std::size_t le
 
 stdx::optional<document::view>
 validate(std::uint8_t const* data, std::size_t length, validator const& validator, std::size_t* invalid_offset) {
-    ::bson_validate_flags_t flags = BSON_VALIDATE_NONE;
+    if (!validate_document(data, length, fast_validator{validator}, to_validate_flags(validator), invalid_offset)) {
+        return bsoncxx::v_noabi::stdx::nullopt;
+    }
 
-    auto const flip_if = [&flags](bool cond, ::bson_validate_flags_t flag) {
-        if (cond) {
-            // this static cast needed to get around invalid conversion warnings...
-            flags = static_cast<::bson_validate_flags_t>(flags | flag);
+    return document::view{data, length};
+}
+
+stdx::optional<std::vector<document::view>> validate_sequence(
+    std::uint8_t const* data,
+    std::size_t length,
+    validator const& validator,
+    std::size_t* invalid_offset) {
+    fast_validator const fast{validator};
+    auto const flags = to_validate_flags(validator);
+
+    std::vector<document::view> documents;
+
+    std::size_t pos = 0u;
+
+    while (pos < length) {
+        std::size_t const remaining = length - pos;
+
+        // A truncated length prefix or a length that overruns the buffer.
+        if (remaining < 5u || load_uint32(data + pos) > remaining) {
+            if (invalid_offset) {
+                *invalid_offset = pos;
+            }
+            return bsoncxx::v_noabi::stdx::nullopt;
         }
-    };
 
-    flip_if(validator.check_dot_keys(), BSON_VALIDATE_DOT_KEYS);
-    flip_if(validator.check_dollar_keys(), BSON_VALIDATE_DOLLAR_KEYS);
-    // we enable VALIDATE_UTF8 if the user wants VALIDATE_UTF8_ALLOW_NULL
-    // otherwise validate_utf8_allow_null() would do nothing due to how libbson
-    // interprets the flag.
-    flip_if((validator.check_utf8() || validator.check_utf8_allow_null()), BSON_VALIDATE_UTF8);
-    flip_if(validator.check_utf8_allow_null(), BSON_VALIDATE_UTF8_ALLOW_NULL);
+        std::size_t const doc_length = load_uint32(data + pos);
+        std::size_t doc_offset = 0u;
 
-    ::bson_t bson;
-    if (!::bson_init_static(&bson, data, length)) {
-        // if we can't even initialize a bson_t we just say the error is at offset 0.
-        if (invalid_offset) {
-            *invalid_offset = 0u;
+        if (!validate_document(data + pos, doc_length, fast, flags, &doc_offset)) {
+            if (invalid_offset) {
+                *invalid_offset = pos + doc_offset;
+            }
+            return bsoncxx::v_noabi::stdx::nullopt;
         }
-        return bsoncxx::v_noabi::stdx::nullopt;
-    }
 
-    if (!::bson_validate(&bson, flags, invalid_offset)) {
-        return bsoncxx::v_noabi::stdx::nullopt;
+        documents.emplace_back(data + pos, doc_length);
+        pos += doc_length;
     }
 
-    return document::view{data, length};
+    return stdx::optional<std::vector<document::view>>{std::move(documents)};
 }
 
 } // namespace v_noabi
@@ -0,0 +1,459 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/vector/algorithms.hpp>
+
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <bsoncxx/exception/error_code.hpp>
+#include <bsoncxx/exception/exception.hpp>
+#include <bsoncxx/vector/detail.hpp>
+#include <bsoncxx/vector/elements.hpp>
+
+#include <bsoncxx/private/simd.hh>
+
+namespace bsoncxx {
+namespace v_noabi {
+namespace vector {
+
+namespace {
+
+template <typename Format>
+void check_same_size(accessor<Format> const& a, accessor<Format> const& b) {
+    if (a.size() != b.size()) {
+        throw exception{error_code::k_vector_size_mismatch};
+    }
+}
+
+float clamp_cosine(double dot, double norm_a, double norm_b) {
+    if (norm_a == 0.0 || norm_b == 0.0) {
+        return 0.f;
+    }
+
+    // Rounding may push the quotient slightly outside of the valid range.
+    return static_cast<float>(std::max(-1.0, std::min(1.0, dot / (std::sqrt(norm_a) * std::sqrt(norm_b)))));
+}
+
+//
+// float32
+//
+// Packed float32 elements are little-endian, so on x86 (the only targets with SSE2) they can be loaded directly as
+// floats. Otherwise each element is converted through elements::float32.
+//
+// Two independent sets of lanes are accumulated to hide the latency of the vector additions.
+//
+
+#if BSONCXX_PRIVATE_SIMD_SSE2
+template <typename T>
+__m128 load4(T const* p) {
+    return _mm_loadu_ps(reinterpret_cast<float const*>(p));
+}
+
+float horizontal_sum(__m128 v) {
+    __m128 const shuffled = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+    __m128 const sums = _mm_add_ps(v, shuffled);
+    return _mm_cvtss_f32(_mm_add_ss(sums, _mm_movehl_ps(shuffled, sums)));
+}
+#endif
+
+template <typename Op, typename A, typename B>
+void for_each_float(A const* a, B const* b, std::size_t n, Op& op) {
+    std::size_t i = 0u;
+
+#if BSONCXX_PRIVATE_SIMD_SSE2
+    for (; i + 8u <= n; i += 8u) {
+        op(0, load4(a + i), load4(b + i));
+        op(1, load4(a + i + 4u), load4(b + i + 4u));
+    }
+
+    for (; i + 4u <= n; i += 4u) {
+        op(0, load4(a + i), load4(b + i));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        op(static_cast<float>(a[i]), static_cast<float>(b[i]));
+    }
+}
+
+struct float_dot {
+#if BSONCXX_PRIVATE_SIMD_SSE2
+    __m128 lanes[2] = {_mm_setzero_ps(), _mm_setzero_ps()};
+
+    void operator()(int k, __m128 a, __m128 b) {
+        lanes[k] = _mm_add_ps(lanes[k], _mm_mul_ps(a, b));
+    }
+#endif
+
+    float dot = 0.f;
+
+    void operator()(float a, float b) {
+        dot += a * b;
+    }
+
+    float result() const {
+#if BSONCXX_PRIVATE_SIMD_SSE2
+        return horizontal_sum(_mm_add_ps(lanes[0], lanes[1])) + dot;
+#else
+        return dot;
+#endif
+    }
+};
+
+struct float_l2 {
+#if BSONCXX_PRIVATE_SIMD_SSE2
+    __m128 lanes[2] = {_mm_setzero_ps(), _mm_setzero_ps()};
+
+    void operator()(int k, __m128 a, __m128 b) {
+        __m128 const d = _mm_sub_ps(a, b);
+        lanes[k] = _mm_add_ps(lanes[k], _mm_mul_ps(d, d));
+    }
+#endif
+
+    float sum = 0.f;
+
+    void operator()(float a, float b) {
+        float const d = a - b;
+        sum += d * d;
+    }
+
+    float result() const {
+#if BSONCXX_PRIVATE_SIMD_SSE2
+        return std::sqrt(horizontal_sum(_mm_add_ps(lanes[0], lanes[1])) + sum);
+#else
+        return std::sqrt(sum);
+#endif
+    }
+};
+
+struct float_cosine {
+#if BSONCXX_PRIVATE_SIMD_SSE2
+    __m128 dot_lanes[2] = {_mm_setzero_ps(), _mm_setzero_ps()};
+    __m128 a_lanes[2] = {_mm_setzero_ps(), _mm_setzero_ps()};
+    __m128 b_lanes[2] = {_mm_setzero_ps(), _mm_setzero_ps()};
+
+    void operator()(int k, __m128 a, __m128 b) {
+        dot_lanes[k] = _mm_add_ps(dot_lanes[k], _mm_mul_ps(a, b));
+        a_lanes[k] = _mm_add_ps(a_lanes[k], _mm_mul_ps(a, a));
+        b_lanes[k] = _mm_add_ps(b_lanes[k], _mm_mul_ps(b, b));
+    }
+#endif
+
+    float dot = 0.f;
+    float norm_a = 0.f;
+    float norm_b = 0.f;
+
+    void operator()(float a, float b) {
+        dot += a * b;
+        norm_a += a * a;
+        norm_b += b * b;
+    }
+
+    float result() const {
+#if BSONCXX_PRIVATE_SIMD_SSE2
+        return clamp_cosine(
+            horizontal_sum(_mm_add_ps(dot_lanes[0], dot_lanes[1])) + dot,
+            horizontal_sum(_mm_add_ps(a_lanes[0], a_lanes[1])) + norm_a,
+            horizontal_sum(_mm_add_ps(b_lanes[0], b_lanes[1])) + norm_b);
+#else
+        return clamp_cosine(dot, norm_a, norm_b);
+#endif
+    }
+};
+
+template <typename Op, typename B>
+float reduce(accessor<formats::f_float32 const> const& vec, B const* b) {
+    Op op;
+    for_each_float(vec.cbegin(), b, vec.size(), op);
+    return op.result();
+}
+
+//
+// int8
+//
+// Elements are sign-extended to 16 bits and multiplied pairwise into 32-bit lanes. The lanes are flushed into 64-bit
+// totals at least every `k_int8_block` elements, well before a lane could overflow.
+//
+
+constexpr std::size_t k_int8_block = std::size_t{1} << 16;
+
+#if BSONCXX_PRIVATE_SIMD_SSE2
+std::int64_t horizontal_sum(__m128i v) {
+    std::int32_t lanes[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), v);
+    return std::int64_t{lanes[0]} + lanes[1] + lanes[2] + lanes[3];
+}
+#endif
+
+template <typename Op>
+void for_each_int8(std::int8_t const* a, std::int8_t const* b, std::size_t n, Op& op) {
+    std::size_t i = 0u;
+
+#if BSONCXX_PRIVATE_SIMD_SSE2
+    while (i + 16u <= n) {
+        std::size_t const block_end = i + std::min(k_int8_block, (n - i) & ~std::size_t{15u});
+
+        for (; i < block_end; i += 16u) {
+            __m128i const va = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i));
+            __m128i const vb = _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + i));
+
+            // Duplicate each byte into a 16-bit lane, then shift arithmetically to sign-extend it.
+            op(_mm_srai_epi16(_mm_unpacklo_epi8(va, va), 8), _mm_srai_epi16(_mm_unpacklo_epi8(vb, vb), 8));
+            op(_mm_srai_epi16(_mm_unpackhi_epi8(va, va), 8), _mm_srai_epi16(_mm_unpackhi_epi8(vb, vb), 8));
+        }
+
+        op.flush();
+    }
+#endif
+
+    for (; i < n; ++i) {
+        op(std::int32_t{a[i]}, std::int32_t{b[i]});
+    }
+}
+
+struct int8_dot {
+#if BSONCXX_PRIVATE_SIMD_SSE2
+    __m128i lanes = _mm_setzero_si128();
+
+    void operator()(__m128i a, __m128i b) {
+        lanes = _mm_add_epi32(lanes, _mm_madd_epi16(a, b));
+    }
+
+    void flush() {
+        dot += horizontal_sum(lanes);
+        lanes = _mm_setzero_si128();
+    }
+#endif
+
+    std::int64_t dot = 0;
+
+    void operator()(std::int32_t a, std::int32_t b) {
+        dot += a * b;
+    }
+};
+
+struct int8_l2 {
+#if BSONCXX_PRIVATE_SIMD_SSE2
+    __m128i lanes = _mm_setzero_si128();
+
+    void operator()(__m128i a, __m128i b) {
+        __m128i const d = _mm_sub_epi16(a, b);
+        lanes = _mm_add_epi32(lanes, _mm_madd_epi16(d, d));
+    }
+
+    void flush() {
+        sum += horizontal_sum(lanes);
+        lanes = _mm_setzero_si128();
+    }
+#endif
+
+    std::int64_t sum = 0;
+
+    void operator()(std::int32_t a, std::int32_t b) {
+        sum += (a - b) * (a - b);
+    }
+};
+
+struct int8_cosine {
+#if BSONCXX_PRIVATE_SIMD_SSE2
+    __m128i dot_lanes = _mm_setzero_si128();
+    __m128i a_lanes = _mm_setzero_si128();
+    __m128i b_lanes = _mm_setzero_si128();
+
+    void operator()(__m128i a, __m128i b) {
+        dot_lanes = _mm_add_epi32(dot_lanes, _mm_madd_epi16(a, b));
+        a_lanes = _mm_add_epi32(a_lanes, _mm_madd_epi16(a, a));
+        b_lanes = _mm_add_epi32(b_lanes, _mm_madd_epi16(b, b));
+    }
+
+    void flush() {
+        dot += horizontal_sum(dot_lanes);
+        norm_a += horizontal_sum(a_lanes);
+        norm_b += horizontal_sum(b_lanes);
+        dot_lanes = a_lanes = b_lanes = _mm_setzero_si128();
+    }
+#endif
+
+    std::int64_t dot = 0;
+    std::int64_t norm_a = 0;
+    std::int64_t norm_b = 0;
+
+    void operator()(std::int32_t a, std::int32_t b) {
+        dot += a * b;
+        norm_a += a * a;
+        norm_b += b * b;
+    }
+};
+
+template <typename Op>
+Op reduce(accessor<formats::f_int8 const> const& vec, std::int8_t const* b) {
+    Op op;
+    for_each_int8(vec.cbegin(), b, vec.size(), op);
+    return op;
+}
+
+//
+// packed_bit
+//
+
+std::size_t popcount(std::uint64_t v) {
+    v = v - ((v >> 1) & 0x5555555555555555u);
+    v = (v & 0x3333333333333333u) + ((v >> 2) & 0x3333333333333333u);
+    v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0Fu;
+    return static_cast<std::size_t>((v * 0x0101010101010101u) >> 56);
+}
+
+std::uint8_t const* packed_bytes(accessor<formats::f_packed_bit const> const& vec) {
+    return detail::accessor_access::data(vec).bytes + detail::header_size;
+}
+
+// Mask of the bits of the last byte which hold elements.
+std::uint8_t last_byte_mask(accessor<formats::f_packed_bit const> const& vec) {
+    return static_cast<std::uint8_t>(0xFFu << (detail::accessor_access::data(vec).header_copy[1] & 7u));
+}
+
+std::size_t hamming(accessor<formats::f_packed_bit const> const& vec, std::uint8_t const* query) {
+    std::uint8_t const* const bytes = packed_bytes(vec);
+    std::size_t const n = vec.byte_size();
+
+    if (n == 0u) {
+        return 0u;
+    }
+
+    std::size_t count = 0u;
+    std::size_t i = 0u;
+
+    for (; i + 8u <= n - 1u; i += 8u) {
+        std::uint64_t a;
+        std::uint64_t b;
+        std::memcpy(&a, bytes + i, sizeof(a));
+        std::memcpy(&b, query + i, sizeof(b));
+        count += popcount(a ^ b);
+    }
+
+    for (; i < n - 1u; ++i) {
+        count += popcount(std::uint64_t{static_cast<std::uint8_t>(bytes[i] ^ query[i])});
+    }
+
+    return count + popcount(std::uint64_t{static_cast<std::uint8_t>((bytes[i] ^ query[i]) & last_byte_mask(vec))});
+}
+
+} // namespace
+
+void copy_to(accessor<formats::f_float32 const> const& vec, float* out) {
+    std::copy(vec.cbegin(), vec.cend(), out);
+}
+
+void copy_to(accessor<formats::f_int8 const> const& vec, std::int8_t* out) {
+    std::memcpy(out, vec.cbegin(), vec.size());
+}
+
+void copy_to(accessor<formats::f_packed_bit const> const& vec, std::uint8_t* out) {
+    std::memcpy(out, packed_bytes(vec), vec.byte_size());
+}
+
+void copy_from(accessor<formats::f_float32> const& vec, float const* in) {
+    std::copy(in, in + vec.size(), vec.begin());
+}
+
+void copy_from(accessor<formats::f_int8> const& vec, std::int8_t const* in) {
+    std::memcpy(vec.begin(), in, vec.size());
+}
+
+void copy_from(accessor<formats::f_packed_bit> const& vec, std::uint8_t const* in) {
+    std::size_t const n = vec.byte_size();
+
+    if (n == 0u) {
+        return;
+    }
+
+    std::uint8_t* const bytes = detail::accessor_access::data(vec).bytes + detail::header_size;
+    std::memcpy(bytes, in, n);
+    bytes[n - 1u] &= last_byte_mask(vec.as_const());
+}
+
+float dot(accessor<formats::f_float32 const> const& a, accessor<formats::f_float32 const> const& b) {
+    check_same_size(a, b);
+    return reduce<float_dot>(a, b.cbegin());
+}
+
+float dot(accessor<formats::f_float32 const> const& vec, float const* query) {
+    return reduce<float_dot>(vec, query);
+}
+
+std::int64_t dot(accessor<formats::f_int8 const> const& a, accessor<formats::f_int8 const> const& b) {
+    check_same_size(a, b);
+    return dot(a, b.cbegin());
+}
+
+std::int64_t dot(accessor<formats::f_int8 const> const& vec, std::int8_t const* query) {
+    return reduce<int8_dot>(vec, query).dot;
+}
+
+float l2_distance(accessor<formats::f_float32 const> const& a, accessor<formats::f_float32 const> const& b) {
+    check_same_size(a, b);
+    return reduce<float_l2>(a, b.cbegin());
+}
+
+float l2_distance(accessor<formats::f_float32 const> const& vec, float const* query) {
+    return reduce<float_l2>(vec, query);
+}
+
+float l2_distance(accessor<formats::f_int8 const> const& a, accessor<formats::f_int8 const> const& b) {
+    check_same_size(a, b);
+    return l2_distance(a, b.cbegin());
+}
+
+float l2_distance(accessor<formats::f_int8 const> const& vec, std::int8_t const* query) {
+    return static_cast<float>(std::sqrt(static_cast<double>(reduce<int8_l2>(vec, query).sum)));
+}
+
+float cosine_similarity(accessor<formats::f_float32 const> const& a, accessor<formats::f_float32 const> const& b) {
+    check_same_size(a, b);
+    return reduce<float_cosine>(a, b.cbegin());
+}
+
+float cosine_similarity(accessor<formats::f_float32 const> const& vec, float const* query) {
+    return reduce<float_cosine>(vec, query);
+}
+
+float cosine_similarity(accessor<formats::f_int8 const> const& a, accessor<formats::f_int8 const> const& b) {
+    check_same_size(a, b);
+    return cosine_similarity(a, b.cbegin());
+}
+
+float cosine_similarity(accessor<formats::f_int8 const> const& vec, std::int8_t const* query) {
+    auto const op = reduce<int8_cosine>(vec, query);
+    return clamp_cosine(
+        static_cast<double>(op.dot), static_cast<double>(op.norm_a), static_cast<double>(op.norm_b));
+}
+
+std::size_t hamming_distance(
+    accessor<formats::f_packed_bit const> const& a,
+    accessor<formats::f_packed_bit const> const& b) {
+    check_same_size(a, b);
+    return hamming(a, packed_bytes(b));
+}
+
+std::size_t hamming_distance(accessor<formats::f_packed_bit const> const& vec, std::uint8_t const* query) {
+    return hamming(vec, query);
+}
+
+} // namespace vector
+} // namespace v_noabi
+} // namespace bsoncxx
@@ -1751,6 +1751,68 @@ TEST_CASE("list builder appends value", "[bsoncxx::builder::list]") {
     bson_destroy(&expected);
 }
 
+TEST_CASE("list builder copies own their data", "[bsoncxx::builder::list]") {
+    bson_t expected, foo, arr;
+
+    bson_init(&expected);
+    bson_init(&foo);
+    bson_init(&arr);
+
+    bson_append_utf8(&foo, "bar", -1, "baz", -1);
+    bson_append_int32(&arr, "0", -1, 1);
+    bson_append_int64(&arr, "1", -1, 2);
+    bson_append_document(&expected, "foo", -1, &foo);
+    bson_append_array(&expected, "arr", -1, &arr);
+
+    builder::list copy;
+    builder::list moved;
+
+    {
+        builder::list original{"foo", {"bar", std::string{"baz"}}, "arr", builder::array{1, std::int64_t{2}}};
+        builder::list other{original};
+        copy = original;
+        moved = std::move(other);
+    }
+
+    bson_eq_object(&expected, copy.view().get_document().value);
+    bson_eq_object(&expected, moved.view().get_document().value);
+
+    builder::list array_copy;
+
+    {
+        builder::array original{1, std::int64_t{2}};
+        array_copy = original;
+    }
+
+    bson_eq_object(&arr, array_copy.view().get_array().value);
+
+    bson_destroy(&expected);
+    bson_destroy(&foo);
+    bson_destroy(&arr);
+}
+
+TEST_CASE("list builder copies character arrays", "[bsoncxx::builder::list]") {
+    char buffer[64];
+
+    std::strcpy(buffer, "short");
+    builder::list short_string = buffer;
+
+    std::strcpy(buffer, "a string which does not fit in the list itself");
+    builder::list long_string = buffer;
+
+    char const unterminated[3] = {'a', 'b', 'c'};
+    builder::list bounded = unterminated;
+
+    std::strcpy(buffer, "overwritten");
+
+    builder::list moved = std::move(short_string);
+    builder::list copied = long_string;
+
+    CHECK(moved.view().get_string().value == stdx::string_view{"short"});
+    CHECK(copied.view().get_string().value == stdx::string_view{"a string which does not fit in the list itself"});
+    CHECK(bounded.view().get_string().value == stdx::string_view{"abc"});
+}
+
 TEST_CASE("list builder with explicit type deduction", "[bsoncxx::builder::list]") {
     using builder::list;
     SECTION("array") {
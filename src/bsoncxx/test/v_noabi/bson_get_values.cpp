@@ -12,11 +12,17 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
+#include <cstdint>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <bsoncxx/builder/basic/array.hpp>
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/sub_array.hpp>
+#include <bsoncxx/exception/error_code.hpp>
+#include <bsoncxx/types.hpp>
 
 #include <bsoncxx/test/catch.hh>
 
@@ -312,6 +318,86 @@ TEST_CASE("array view begin/end/find give expected types", "[bsoncxx]") {
     }
 }
 
+TEST_CASE("iterators visit elements of every type", "[bsoncxx]") {
+    using namespace bsoncxx::types;
+
+    std::uint8_t const bytes[] = {0xde, 0xad, 0xbe, 0xef};
+    oid const id;
+    auto const scope = make_document(kvp("x", 1));
+
+    auto const value = make_document(
+        kvp("double", b_double{1.5}),
+        kvp("string", b_string{"hello"}),
+        kvp("document", make_document(kvp("a", 1), kvp("b", "two"))),
+        kvp("array", make_array(1, "two", 3.0)),
+        kvp("binary", b_binary{binary_sub_type::k_binary, sizeof(bytes), bytes}),
+        kvp("undefined", b_undefined{}),
+        kvp("oid", b_oid{id}),
+        kvp("bool", b_bool{true}),
+        kvp("date", b_date{std::chrono::milliseconds{-123456789}}),
+        kvp("null", b_null{}),
+        kvp("regex", b_regex{"^foo|bar$", "i"}),
+        kvp("dbpointer", b_dbpointer{"db.coll", id}),
+        kvp("code", b_code{"var a = b;"}),
+        kvp("symbol", b_symbol{"sym"}),
+        kvp("codewscope", b_codewscope{"var a = x;", scope.view()}),
+        kvp("int32", b_int32{-42}),
+        kvp("timestamp", b_timestamp{100, 1000}),
+        kvp("int64", b_int64{-(std::int64_t{1} << 40)}),
+        kvp("decimal128", b_decimal128{"-1234E+999"}),
+        kvp("maxkey", b_maxkey{}),
+        kvp("minkey", b_minkey{}),
+        kvp("", "empty key"));
+
+    auto const doc = value.view();
+
+    std::vector<std::string> keys;
+    for (auto const& e : doc) {
+        keys.emplace_back(e.key());
+        CHECK(doc[e.key()].offset() == e.offset());
+    }
+
+    CHECK(keys == std::vector<std::string>{"double", "string", "document", "array", "binary", "undefined", "oid",
+                                           "bool", "date", "null", "regex", "dbpointer", "code", "symbol",
+                                           "codewscope", "int32", "timestamp", "int64", "decimal128", "maxkey",
+                                           "minkey", ""});
+
+    CHECK(doc["double"].get_double() == 1.5);
+    CHECK(doc["string"].get_string().value == stdx::string_view{"hello"});
+    CHECK(doc["document"]["b"].get_string().value == stdx::string_view{"two"});
+    CHECK(doc["array"][2].get_double() == 3.0);
+    CHECK(doc["binary"].get_binary().size == sizeof(bytes));
+    CHECK(doc["undefined"].type() == type::k_undefined);
+    CHECK(doc["oid"].get_oid().value == id);
+    CHECK(doc["bool"].get_bool().value);
+    CHECK(doc["date"].get_date() == b_date{std::chrono::milliseconds{-123456789}});
+    CHECK(doc["null"].type() == type::k_null);
+    CHECK(doc["regex"].get_regex().options == stdx::string_view{"i"});
+    CHECK(doc["dbpointer"].get_dbpointer().value == id);
+    CHECK(doc["code"].get_code().code == stdx::string_view{"var a = b;"});
+    CHECK(doc["symbol"].get_symbol().symbol == stdx::string_view{"sym"});
+    CHECK(doc["codewscope"].get_codewscope().scope == scope.view());
+    CHECK(doc["int32"].get_int32() == -42);
+    CHECK(doc["timestamp"].get_timestamp() == b_timestamp{100, 1000});
+    CHECK(doc["int64"].get_int64() == -(std::int64_t{1} << 40));
+    CHECK(doc["decimal128"].get_decimal128() == b_decimal128{"-1234E+999"});
+    CHECK(doc["maxkey"].type() == type::k_maxkey);
+    CHECK(doc["minkey"].type() == type::k_minkey);
+    CHECK(doc[""].get_string().value == stdx::string_view{"empty key"});
+
+    std::vector<type> array_types;
+    for (auto const& e : doc["array"].get_array().value) {
+        array_types.push_back(e.type());
+    }
+    CHECK(array_types == std::vector<type>{type::k_int32, type::k_string, type::k_double});
+
+    SECTION("accessors throw on a type mismatch") {
+        CHECK_THROWS_WITH_CODE(doc["double"].get_int32(), error_code::k_need_element_type_k_int32);
+        CHECK_THROWS_WITH_CODE(doc["string"].get_document(), error_code::k_need_element_type_k_document);
+        CHECK_THROWS_WITH_CODE(doc["int64"].get_binary(), error_code::k_need_element_type_k_binary);
+    }
+}
+
 TEST_CASE("CXX-1476: CXX-992 regression fixes", "[bsoncxx]") {
     SECTION("request for field 'o' does not return field 'op'") {
         constexpr auto k_json = R"({ "op" : 1, "o" : 2 })";
@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
 
 #include <bsoncxx/builder/basic/array.hpp>
 #include <bsoncxx/builder/basic/document.hpp>
@@ -127,5 +130,83 @@ TEST_CASE("configuring optional validations", "[bsoncxx::validate]") {
 
         REQUIRE(invalid_offset == std::size_t{9});
     }
+
+    SECTION("we accept valid multi-byte utf8") {
+        vtor.check_utf8(true);
+        doc.append(kvp("h\xC3\xA9llo", "w\xC3\xB6rld \xE2\x82\xAC \xF0\x9F\x98\x80, then more than sixteen bytes"));
+        auto view = doc.view();
+        REQUIRE(is_engaged(validate(view.data(), view.length(), vtor)));
+    }
+
+    SECTION("we reject invalid utf8 past the first sixteen bytes") {
+        vtor.check_utf8(true);
+        std::string invalid_utf8(40, 'x');
+        invalid_utf8[20] = '\xFF';
+        doc.append(kvp("bar", invalid_utf8));
+        auto view = doc.view();
+        REQUIRE(is_disengaged(validate(view.data(), view.length(), vtor)));
+    }
+
+    SECTION("we reject overlong utf8 encodings") {
+        vtor.check_utf8(true);
+        doc.append(kvp("bar", "\xC0\xAF"));
+        auto view = doc.view();
+        REQUIRE(is_disengaged(validate(view.data(), view.length(), vtor)));
+    }
+}
+
+TEST_CASE("validate_sequence", "[bsoncxx::validate]") {
+    validator vtor{};
+    vtor.check_dollar_keys(true);
+
+    auto const first = make_document(kvp("hello", "world"));
+    auto const second = make_document(kvp("x", make_array(1, 2, 3)));
+    auto const invalid = make_document(kvp("$foo", "bar"));
+
+    std::vector<std::uint8_t> buffer;
+    auto const append = [&buffer](document::view view) {
+        buffer.insert(buffer.end(), view.data(), view.data() + view.length());
+    };
+
+    SECTION("accepts an empty sequence") {
+        auto const documents = validate_sequence(buffer.data(), buffer.size(), vtor);
+        REQUIRE(is_engaged(documents));
+        CHECK(documents->empty());
+    }
+
+    SECTION("returns a view of each document") {
+        append(first.view());
+        append(second.view());
+
+        auto const documents = validate_sequence(buffer.data(), buffer.size(), vtor);
+        REQUIRE(is_engaged(documents));
+        REQUIRE(documents->size() == 2u);
+        CHECK((*documents)[0] == first.view());
+        CHECK((*documents)[1] == second.view());
+        CHECK((*documents)[1].data() == buffer.data() + first.view().length());
+    }
+
+    SECTION("reports the offset of an invalid document") {
+        append(first.view());
+        append(invalid.view());
+        append(second.view());
+
+        std::size_t invalid_offset{0u};
+        REQUIRE(is_disengaged(validate_sequence(buffer.data(), buffer.size(), vtor, &invalid_offset)));
+
+        std::size_t document_offset{0u};
+        REQUIRE(is_disengaged(validate(invalid.view().data(), invalid.view().length(), vtor, &document_offset)));
+        CHECK(invalid_offset == first.view().length() + document_offset);
+    }
+
+    SECTION("rejects a truncated document") {
+        append(first.view());
+        append(second.view());
+        buffer.pop_back();
+
+        std::size_t invalid_offset{0u};
+        REQUIRE(is_disengaged(validate_sequence(buffer.data(), buffer.size(), vtor, &invalid_offset)));
+        CHECK(invalid_offset == first.view().length());
+    }
 }
 } // namespace
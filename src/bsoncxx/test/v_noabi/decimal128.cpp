@@ -0,0 +1,116 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <bsoncxx/decimal128.hpp>
+#include <bsoncxx/exception/error_code.hpp>
+#include <bsoncxx/stdx/string_view.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::decimal128;
+using bsoncxx::stdx::string_view;
+
+TEST_CASE("decimal128 to_chars", "[bsoncxx::decimal128]") {
+    char buf[decimal128::k_max_string_length + 1];
+    std::memset(buf, '#', sizeof(buf));
+
+    SECTION("writes the string representation without a null terminator") {
+        decimal128 const d{"-12.34"};
+        char* const end = d.to_chars(buf);
+
+        CHECK(std::string(buf, end) == "-12.34");
+        CHECK(*end == '#');
+        CHECK(d.to_string() == "-12.34");
+    }
+
+    SECTION("fits the longest representation") {
+        decimal128 const d{"-1.234567890123456789012345678901234E-6143"};
+        char* const end = d.to_chars(buf);
+
+        CHECK(static_cast<std::size_t>(end - buf) <= decimal128::k_max_string_length);
+        CHECK(std::string(buf, end) == d.to_string());
+        CHECK(buf[decimal128::k_max_string_length] == '#');
+    }
+}
+
+TEST_CASE("decimal128 from_chars", "[bsoncxx::decimal128]") {
+    SECTION("parses a string without a null terminator") {
+        char const str[] = {'1', '2', '.', '5', '0', '9'};
+
+        auto const d = decimal128::from_chars(string_view{str, 5});
+
+        REQUIRE(d);
+        CHECK(*d == decimal128{"12.50"});
+    }
+
+    SECTION("rejects invalid strings") {
+        CHECK_FALSE(decimal128::from_chars(string_view{}));
+        CHECK_FALSE(decimal128::from_chars(""));
+        CHECK_FALSE(decimal128::from_chars("1.2.3"));
+        CHECK_FALSE(decimal128::from_chars("abc"));
+        CHECK_FALSE(decimal128::from_chars(string_view{"1\0" "2", 3}));
+    }
+
+    SECTION("the string constructor throws on invalid strings") {
+        CHECK_THROWS_WITH_CODE(decimal128{"1.2.3"}, bsoncxx::error_code::k_invalid_decimal128);
+    }
+}
+
+TEST_CASE("decimal128 batch conversions", "[bsoncxx::decimal128]") {
+    std::vector<string_view> const strs = {"0.01", "-42", "1E+10", "NaN", "Infinity"};
+
+    SECTION("round trip") {
+        std::vector<decimal128> values(strs.size());
+
+        REQUIRE(decimal128::from_chars(strs.data(), strs.data() + strs.size(), values.data()) == strs.size());
+
+        std::vector<char> buf(values.size() * decimal128::k_max_string_length);
+        std::vector<char*> ends(values.size());
+
+        char* const end = decimal128::to_chars(values.data(), values.data() + values.size(), buf.data(), ends.data());
+
+        CHECK(end == ends.back());
+        CHECK(std::string(buf.data(), end) == "0.01-421E+10NaNInfinity");
+
+        char const* begin = buf.data();
+        for (std::size_t i = 0u; i < values.size(); ++i) {
+            CHECK(string_view{begin, static_cast<std::size_t>(ends[i] - begin)} == values[i].to_string());
+            begin = ends[i];
+        }
+    }
+
+    SECTION("stops at the first invalid string") {
+        std::vector<string_view> const invalid = {"1", "2", "x", "4"};
+        std::vector<decimal128> values(invalid.size());
+
+        CHECK(decimal128::from_chars(invalid.data(), invalid.data() + invalid.size(), values.data()) == 2u);
+        CHECK(values[0] == decimal128{"1"});
+        CHECK(values[1] == decimal128{"2"});
+    }
+
+    SECTION("empty ranges") {
+        CHECK(decimal128::from_chars(strs.data(), strs.data(), nullptr) == 0u);
+
+        char buf[1];
+        CHECK(decimal128::to_chars(nullptr, nullptr, buf) == buf);
+    }
+}
+
+} // namespace
@@ -0,0 +1,127 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/builder/document_template.hpp>
+#include <bsoncxx/decimal128.hpp>
+#include <bsoncxx/oid.hpp>
+#include <bsoncxx/stdx/string_view.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using namespace bsoncxx;
+
+using builder::basic::kvp;
+using builder::basic::make_document;
+
+TEST_CASE("document_template with fixed-size values", "[bsoncxx::builder::document_template]") {
+    auto const t = builder::make_document_template(
+        builder::slot<double>{"double"},
+        builder::slot<oid>{"oid"},
+        builder::slot<bool>{"bool"},
+        builder::slot<types::b_date>{"date"},
+        builder::slot<std::int32_t>{"int32"},
+        builder::nest("nested", builder::slot<types::b_timestamp>{"timestamp"}, builder::slot<std::int64_t>{"int64"}),
+        builder::slot<decimal128>{"decimal128"});
+
+    STATIC_REQUIRE(decltype(t)::size() == 8u);
+
+    oid const id;
+    types::b_date const date{std::chrono::milliseconds{123456789}};
+    types::b_timestamp const ts{1u, 2u};
+    decimal128 const dec{"-1234E+999"};
+
+    auto const doc = t.build(1.5, id, true, date, 42, ts, std::int64_t{-7}, dec);
+
+    auto const expected = make_document(
+        kvp("double", 1.5),
+        kvp("oid", id),
+        kvp("bool", true),
+        kvp("date", date),
+        kvp("int32", 42),
+        kvp("nested", make_document(kvp("timestamp", ts), kvp("int64", std::int64_t{-7}))),
+        kvp("decimal128", dec));
+
+    CHECK(doc.view() == expected.view());
+
+    SECTION("placeholders") {
+        auto const placeholders = make_document(
+            kvp("double", 0.0),
+            kvp("oid", oid{"000000000000000000000000"}),
+            kvp("bool", false),
+            kvp("date", types::b_date{std::chrono::milliseconds{0}}),
+            kvp("int32", 0),
+            kvp("nested",
+                make_document(kvp("timestamp", types::b_timestamp{0u, 0u}), kvp("int64", std::int64_t{0}))),
+            kvp("decimal128", decimal128{0u, 0u}));
+
+        CHECK(t.view() == placeholders.view());
+    }
+
+    SECTION("reuse") {
+        CHECK(t.build(2.5, id, false, date, 0, ts, std::int64_t{0}, dec).view()["double"].get_double().value == 2.5);
+        CHECK(t.build(1.5, id, true, date, 42, ts, std::int64_t{-7}, dec).view() == expected.view());
+    }
+}
+
+TEST_CASE("document_template with strings", "[bsoncxx::builder::document_template]") {
+    auto const t = builder::make_document_template(
+        builder::slot<std::int64_t>{"_id"},
+        builder::slot<stdx::string_view>{"tenant"},
+        builder::nest("v", builder::slot<std::int32_t>{"$gt"}, builder::slot<stdx::string_view>{"s"}),
+        builder::slot<stdx::string_view>{"last"});
+
+    STATIC_REQUIRE(decltype(t)::size() == 5u);
+
+    SECTION("values") {
+        std::string const tenant{"acme"};
+
+        auto const doc = t.build(std::int64_t{42}, tenant, 7, "xy", stdx::string_view{});
+
+        auto const expected = make_document(
+            kvp("_id", std::int64_t{42}),
+            kvp("tenant", "acme"),
+            kvp("v", make_document(kvp("$gt", 7), kvp("s", "xy"))),
+            kvp("last", ""));
+
+        CHECK(doc.view() == expected.view());
+    }
+
+    SECTION("embedded null") {
+        stdx::string_view const s{"a\0b", 3u};
+
+        auto const doc = t.build(std::int64_t{0}, s, 0, s, s);
+
+        CHECK(doc.view()["tenant"].get_string().value == s);
+        CHECK(doc.view()["v"]["s"].get_string().value == s);
+        CHECK(doc.view()["last"].get_string().value == s);
+    }
+}
+
+TEST_CASE("empty document_template", "[bsoncxx::builder::document_template]") {
+    auto const t = builder::make_document_template();
+
+    CHECK(t.build().view() == make_document().view());
+    CHECK(t.view() == make_document().view());
+}
+
+} // namespace
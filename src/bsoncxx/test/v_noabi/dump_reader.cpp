@@ -0,0 +1,163 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/dump_reader.hpp>
+
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/exception/error_code.hpp>
+#include <bsoncxx/exception/exception.hpp>
+#include <bsoncxx/validate.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using namespace bsoncxx;
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+// Writes the given bytes to a file which is removed at the end of the test.
+class temporary_file {
+   public:
+    temporary_file(std::string path, std::vector<std::uint8_t> const& bytes) : _path{std::move(path)} {
+        std::ofstream out{_path, std::ios::binary | std::ios::trunc};
+        out.write(reinterpret_cast<char const*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        REQUIRE(out.good());
+    }
+
+    ~temporary_file() {
+        std::remove(_path.c_str());
+    }
+
+    temporary_file(temporary_file const&) = delete;
+    temporary_file& operator=(temporary_file const&) = delete;
+
+    std::string const& path() const {
+        return _path;
+    }
+
+   private:
+    std::string _path;
+};
+
+void append(std::vector<std::uint8_t>& bytes, document::view doc) {
+    bytes.insert(bytes.end(), doc.data(), doc.data() + doc.length());
+}
+
+TEST_CASE("dump_reader indexes documents without copying", "[bsoncxx::dump_reader]") {
+    std::vector<std::uint8_t> bytes;
+    for (std::int32_t i = 0; i < 1000; ++i) {
+        append(bytes, make_document(kvp("i", i), kvp("s", std::string(static_cast<std::size_t>(i % 50), 'x'))));
+    }
+
+    temporary_file const file{"bsoncxx-test-dump_reader-index.bson", bytes};
+    dump_reader const reader{file.path()};
+
+    REQUIRE(reader.length() == bytes.size());
+    CHECK(reader.indexed_length() == bytes.size());
+    REQUIRE(reader.size() == 1000u);
+    CHECK_FALSE(reader.empty());
+
+    std::int32_t expected = 0;
+    for (auto const& doc : reader) {
+        CHECK(doc["i"].get_int32().value == expected);
+        CHECK(doc.data() >= reader.data());
+        CHECK(doc.data() + doc.length() <= reader.data() + reader.length());
+        ++expected;
+    }
+
+    CHECK(reader[999]["i"].get_int32().value == 999);
+    CHECK(reader[500].data() == reader[499].data() + reader[499].length());
+
+    validator v;
+    for (std::size_t thread_count : {0u, 1u, 2u, 7u, 2000u}) {
+        CHECK(reader.validate(v, nullptr, thread_count));
+    }
+}
+
+TEST_CASE("dump_reader stops indexing at a truncated document", "[bsoncxx::dump_reader]") {
+    std::vector<std::uint8_t> bytes;
+    append(bytes, make_document(kvp("a", 1)));
+    append(bytes, make_document(kvp("b", 2)));
+
+    auto const complete_length = bytes.size();
+
+    auto const truncated = make_document(kvp("c", 3));
+    bytes.insert(bytes.end(), truncated.view().data(), truncated.view().data() + truncated.view().length() - 1u);
+
+    temporary_file const file{"bsoncxx-test-dump_reader-truncated.bson", bytes};
+    dump_reader const reader{file.path()};
+
+    CHECK(reader.length() == bytes.size());
+    CHECK(reader.indexed_length() == complete_length);
+    CHECK(reader.size() == 2u);
+    CHECK(reader[1]["b"].get_int32().value == 2);
+}
+
+TEST_CASE("dump_reader reports the first invalid document", "[bsoncxx::dump_reader]") {
+    std::vector<std::uint8_t> bytes;
+    for (std::int32_t i = 0; i < 100; ++i) {
+        append(bytes, make_document(kvp("i", i)));
+    }
+
+    auto const first_invalid = bytes.size();
+
+    append(bytes, make_document(kvp("$i", 100)));
+    for (std::int32_t i = 101; i < 200; ++i) {
+        append(bytes, make_document(kvp("i", i)));
+    }
+    append(bytes, make_document(kvp("$i", 200)));
+
+    temporary_file const file{"bsoncxx-test-dump_reader-invalid.bson", bytes};
+    dump_reader const reader{file.path()};
+    REQUIRE(reader.size() == 201u);
+
+    validator v;
+    CHECK(reader.validate(v));
+
+    v.check_dollar_keys(true);
+    for (std::size_t thread_count : {1u, 3u, 16u}) {
+        std::size_t invalid_offset = 0u;
+        CHECK_FALSE(reader.validate(v, &invalid_offset, thread_count));
+        CHECK(invalid_offset >= first_invalid);
+        CHECK(invalid_offset < first_invalid + reader[100].length());
+    }
+}
+
+TEST_CASE("dump_reader accepts an empty file", "[bsoncxx::dump_reader]") {
+    temporary_file const file{"bsoncxx-test-dump_reader-empty.bson", {}};
+    dump_reader const reader{file.path()};
+
+    CHECK(reader.length() == 0u);
+    CHECK(reader.empty());
+    CHECK(reader.begin() == reader.end());
+    CHECK(reader.validate(validator{}, nullptr, 4u));
+}
+
+TEST_CASE("dump_reader throws if the file cannot be opened", "[bsoncxx::dump_reader]") {
+    CHECK_THROWS_WITH_CODE(
+        dump_reader{"bsoncxx-test-dump_reader-missing.bson"}, bsoncxx::v_noabi::error_code::k_cannot_map_file);
+}
+
+} // namespace
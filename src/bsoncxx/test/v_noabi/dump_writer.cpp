@@ -0,0 +1,111 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/dump_writer.hpp>
+
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/dump_reader.hpp>
+#include <bsoncxx/exception/error_code.hpp>
+#include <bsoncxx/exception/exception.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using namespace bsoncxx;
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+TEST_CASE("dump_writer writes documents back to back", "[bsoncxx::dump_writer]") {
+    std::string const path = "bsoncxx-test-dump_writer.bson";
+
+    std::vector<document::value> docs;
+    for (std::int32_t i = 0; i < 500; ++i) {
+        // Every 100th document is larger than a buffer and is written without being copied.
+        auto const size = static_cast<std::size_t>(i % 100 == 0 ? 10000 : i);
+        docs.push_back(make_document(kvp("i", i), kvp("s", std::string(size, 'x'))));
+    }
+
+    auto const background = GENERATE(false, true);
+
+    std::uint64_t bytes = 0u;
+    {
+        dump_writer writer{path, 4096u, background};
+
+        writer.write(docs.begin(), docs.begin() + 250);
+        for (auto it = docs.begin() + 250; it != docs.end(); ++it) {
+            writer.write(it->view());
+            bytes += it->view().length();
+        }
+
+        for (auto it = docs.begin(); it != docs.begin() + 250; ++it) {
+            bytes += it->view().length();
+        }
+
+        CHECK(writer.documents_written() == docs.size());
+        CHECK(writer.bytes_written() == bytes);
+
+        writer.flush();
+    }
+
+    {
+        dump_reader const reader{path};
+
+        CHECK(reader.length() == bytes);
+        REQUIRE(reader.size() == docs.size());
+
+        for (std::size_t i = 0u; i < docs.size(); ++i) {
+            CHECK(reader[i] == docs[i].view());
+        }
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("dump_writer writes pending documents when destroyed", "[bsoncxx::dump_writer]") {
+    std::string const path = "bsoncxx-test-dump_writer-destroyed.bson";
+
+    auto const background = GENERATE(false, true);
+
+    {
+        dump_writer writer{path, dump_writer::k_default_buffer_size, background};
+        writer.write(make_document(kvp("a", 1))).write(make_document(kvp("b", 2)));
+    }
+
+    {
+        dump_reader const reader{path};
+        REQUIRE(reader.size() == 2u);
+        CHECK(reader[1]["b"].get_int32().value == 2);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("dump_writer throws if the file cannot be opened", "[bsoncxx::dump_writer]") {
+    CHECK_THROWS_WITH_CODE(
+        dump_writer{"bsoncxx-test-dump_writer-missing/directory.bson"},
+        bsoncxx::v_noabi::error_code::k_cannot_write_file);
+}
+
+} // namespace
@@ -15,10 +15,12 @@
 #include <chrono>
 #include <cstring>
 #include <ctime>
+#include <string>
 #include <iomanip>
 #include <sstream>
 #include <stdlib.h>
 
+#include <bsoncxx/exception/error_code.hpp>
 #include <bsoncxx/oid.hpp>
 
 #include <bsoncxx/private/bson.hh>
@@ -122,4 +124,58 @@ TEST_CASE("oid", "[bsoncxx::oid]") {
     }
 }
 
+TEST_CASE("oid hexadecimal conversions", "[bsoncxx::oid]") {
+    char const bytes[] = "\x00\x01\x23\x45\x67\x89\xab\xcd\xef\x9a\xf0\xff";
+    oid const id{bytes, oid::size()};
+
+    SECTION("to_chars writes lowercase hex without a null terminator") {
+        char buf[oid::k_oid_string_length + 1];
+        std::memset(buf, '#', sizeof(buf));
+
+        char* const end = id.to_chars(buf);
+
+        REQUIRE(end == buf + oid::k_oid_string_length);
+        CHECK(std::string(buf, end) == "000123456789abcdef9af0ff");
+        CHECK(buf[oid::k_oid_string_length] == '#');
+        CHECK(id.to_string() == std::string(buf, end));
+    }
+
+    SECTION("from_chars round trips to_chars") {
+        oid const generated;
+        char buf[oid::k_oid_string_length];
+
+        generated.to_chars(buf);
+
+        auto const parsed = oid::from_chars(stdx::string_view{buf, sizeof(buf)});
+
+        REQUIRE(parsed);
+        CHECK(*parsed == generated);
+    }
+
+    SECTION("from_chars accepts either case") {
+        auto const lower = oid::from_chars("000123456789abcdef9af0ff");
+        auto const upper = oid::from_chars("000123456789ABCDEF9AF0FF");
+
+        REQUIRE(lower);
+        REQUIRE(upper);
+        CHECK(*lower == id);
+        CHECK(*upper == id);
+    }
+
+    SECTION("from_chars rejects invalid strings") {
+        CHECK_FALSE(oid::from_chars(""));
+        CHECK_FALSE(oid::from_chars("000123456789abcdef9af0f"));
+        CHECK_FALSE(oid::from_chars("000123456789abcdef9af0ff0"));
+        CHECK_FALSE(oid::from_chars("000123456789abcdef9af0fg"));
+        CHECK_FALSE(oid::from_chars("g00123456789abcdef9af0ff"));
+        CHECK_FALSE(oid::from_chars("000123456789abcdef9af0f:"));
+        CHECK_FALSE(oid::from_chars("000123456789abcdef9af0f@"));
+    }
+
+    SECTION("the string constructor throws on invalid strings") {
+        CHECK(oid{"000123456789abcdef9af0ff"} == id);
+        CHECK_THROWS_WITH_CODE(oid{"000123456789abcdef9af0fg"}, error_code::k_invalid_oid);
+    }
+}
+
 } // namespace
@@ -16,11 +16,17 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
 
+#include <bsoncxx/builder/basic/array.hpp>
 #include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/sub_array.hpp>
 #include <bsoncxx/builder/basic/sub_binary.hpp>
 #include <bsoncxx/types.hpp>
 #include <bsoncxx/vector/accessor.hpp>
+#include <bsoncxx/vector/algorithms.hpp>
 #include <bsoncxx/vector/formats.hpp>
 
 #include <bsoncxx/test/catch.hh>
@@ -590,4 +596,231 @@ TEST_CASE("vector accessor packed_bit", "[bsoncxx::vector::accessor]") {
     }
 }
 
+TEST_CASE("vector algorithms float32", "[bsoncxx::vector::algorithms]") {
+    using namespace builder::basic;
+
+    // Lengths which exercise both the vectorized body and the scalar tail.
+    auto element_count = GENERATE(0u, 1u, 3u, 4u, 7u, 8u, 17u, 100u, 1537u);
+
+    std::vector<float> a(element_count);
+    std::vector<float> b(element_count);
+    for (std::size_t i = 0u; i < element_count; ++i) {
+        a[i] = float(i % 13u) * 0.25f - 1.5f;
+        b[i] = float(i % 7u) * -0.5f + 1.25f;
+    }
+
+    bsoncxx::document::value doc = make_document(
+        kvp("a",
+            [&](sub_binary sbin) {
+                vector::copy_from(sbin.allocate(vector::formats::f_float32{}, a.size()), a.data());
+            }),
+        kvp("b",
+            [&](sub_binary sbin) {
+                vector::copy_from(sbin.allocate(vector::formats::f_float32{}, b.size()), b.data());
+            }));
+
+    vector::accessor<vector::formats::f_float32 const> vec_a{doc.view()["a"].get_binary()};
+    vector::accessor<vector::formats::f_float32 const> vec_b{doc.view()["b"].get_binary()};
+    REQUIRE(vec_a.size() == element_count);
+
+    double expected_dot = 0.0;
+    double expected_l2 = 0.0;
+    double norm_a = 0.0;
+    double norm_b = 0.0;
+    for (std::size_t i = 0u; i < element_count; ++i) {
+        expected_dot += double(a[i]) * b[i];
+        expected_l2 += (double(a[i]) - b[i]) * (double(a[i]) - b[i]);
+        norm_a += double(a[i]) * a[i];
+        norm_b += double(b[i]) * b[i];
+    }
+    expected_l2 = std::sqrt(expected_l2);
+    double const expected_cosine = element_count == 0u ? 0.0 : expected_dot / std::sqrt(norm_a * norm_b);
+
+    SECTION("copy round trip") {
+        std::vector<float> out(element_count);
+        vector::copy_to(vec_a, out.data());
+        CHECK(out == a);
+    }
+
+    SECTION("dot product") {
+        CHECK(std::fabs(vector::dot(vec_a, vec_b) - expected_dot) < 1e-2);
+        CHECK(std::fabs(vector::dot(vec_a, b.data()) - expected_dot) < 1e-2);
+    }
+
+    SECTION("euclidean distance") {
+        CHECK(std::fabs(vector::l2_distance(vec_a, vec_b) - expected_l2) < 1e-3);
+        CHECK(std::fabs(vector::l2_distance(vec_a, b.data()) - expected_l2) < 1e-3);
+    }
+
+    SECTION("cosine similarity") {
+        CHECK(std::fabs(vector::cosine_similarity(vec_a, vec_b) - expected_cosine) < 1e-4);
+        CHECK(std::fabs(vector::cosine_similarity(vec_a, b.data()) - expected_cosine) < 1e-4);
+    }
+}
+
+TEST_CASE("vector algorithms int8", "[bsoncxx::vector::algorithms]") {
+    using namespace builder::basic;
+
+    auto element_count = GENERATE(0u, 1u, 15u, 16u, 33u, 1000u);
+
+    std::vector<std::int8_t> a(element_count);
+    std::vector<std::int8_t> b(element_count);
+    for (std::size_t i = 0u; i < element_count; ++i) {
+        a[i] = std::int8_t(int(i * 37u % 256u) - 128);
+        b[i] = std::int8_t(127 - int(i * 11u % 256u));
+    }
+
+    bsoncxx::document::value doc = make_document(
+        kvp("a",
+            [&](sub_binary sbin) {
+                vector::copy_from(sbin.allocate(vector::formats::f_int8{}, a.size()), a.data());
+            }),
+        kvp("b",
+            [&](sub_binary sbin) {
+                vector::copy_from(sbin.allocate(vector::formats::f_int8{}, b.size()), b.data());
+            }));
+
+    vector::accessor<vector::formats::f_int8 const> vec_a{doc.view()["a"].get_binary()};
+    vector::accessor<vector::formats::f_int8 const> vec_b{doc.view()["b"].get_binary()};
+
+    std::int64_t expected_dot = 0;
+    std::int64_t expected_l2 = 0;
+    for (std::size_t i = 0u; i < element_count; ++i) {
+        expected_dot += a[i] * b[i];
+        expected_l2 += (a[i] - b[i]) * (a[i] - b[i]);
+    }
+
+    std::vector<std::int8_t> out(element_count);
+    vector::copy_to(vec_a, out.data());
+    CHECK(out == a);
+
+    CHECK(vector::dot(vec_a, vec_b) == expected_dot);
+    CHECK(vector::dot(vec_a, b.data()) == expected_dot);
+    CHECK(std::fabs(vector::l2_distance(vec_a, vec_b) - std::sqrt(double(expected_l2))) < 1e-3);
+    CHECK(std::fabs(vector::cosine_similarity(vec_a, vec_a) - (element_count == 0u ? 0.0 : 1.0)) < 1e-5);
+}
+
+TEST_CASE("vector algorithms packed_bit", "[bsoncxx::vector::algorithms]") {
+    using namespace builder::basic;
+
+    SECTION("hamming distance ignores unused trailing bits") {
+        for (std::size_t element_count = 0u; element_count < 100u; element_count++) {
+            std::vector<std::uint8_t> ones((element_count + 7u) / 8u, UINT8_C(0xFF));
+
+            bsoncxx::document::value doc = make_document(
+                kvp("zeros", [&](sub_binary sbin) { sbin.allocate(vector::formats::f_packed_bit{}, element_count); }),
+                kvp("ones", [&](sub_binary sbin) {
+                    auto vec = sbin.allocate(vector::formats::f_packed_bit{}, element_count);
+                    vector::copy_from(vec, ones.data());
+                    CHECK(std::all_of(vec.begin(), vec.end(), [](bool value) { return value; }));
+                }));
+
+            vector::accessor<vector::formats::f_packed_bit const> zeros{doc.view()["zeros"].get_binary()};
+            vector::accessor<vector::formats::f_packed_bit const> all_set{doc.view()["ones"].get_binary()};
+
+            CHECK(vector::hamming_distance(zeros, all_set) == element_count);
+            CHECK(vector::hamming_distance(zeros, ones.data()) == element_count);
+            CHECK(vector::hamming_distance(all_set, ones.data()) == 0u);
+
+            std::vector<std::uint8_t> out(ones.size());
+            vector::copy_to(all_set, out.data());
+            if (!out.empty()) {
+                CHECK(out.back() == std::uint8_t(0xFF << (out.size() * 8u - element_count)));
+            }
+        }
+    }
+}
+
+TEST_CASE("vector algorithms reject vectors of different sizes", "[bsoncxx::vector::algorithms]") {
+    using namespace builder::basic;
+
+    bsoncxx::document::value doc = make_document(
+        kvp("f1", [&](sub_binary sbin) { sbin.allocate(vector::formats::f_float32{}, 1u); }),
+        kvp("f2", [&](sub_binary sbin) { sbin.allocate(vector::formats::f_float32{}, 2u); }),
+        kvp("i1", [&](sub_binary sbin) { sbin.allocate(vector::formats::f_int8{}, 1u); }),
+        kvp("i2", [&](sub_binary sbin) { sbin.allocate(vector::formats::f_int8{}, 2u); }),
+        kvp("b1", [&](sub_binary sbin) { sbin.allocate(vector::formats::f_packed_bit{}, 1u); }),
+        kvp("b2", [&](sub_binary sbin) { sbin.allocate(vector::formats::f_packed_bit{}, 2u); }));
+
+    vector::accessor<vector::formats::f_float32 const> f1{doc.view()["f1"].get_binary()};
+    vector::accessor<vector::formats::f_float32 const> f2{doc.view()["f2"].get_binary()};
+    vector::accessor<vector::formats::f_int8 const> i1{doc.view()["i1"].get_binary()};
+    vector::accessor<vector::formats::f_int8 const> i2{doc.view()["i2"].get_binary()};
+    vector::accessor<vector::formats::f_packed_bit const> b1{doc.view()["b1"].get_binary()};
+    vector::accessor<vector::formats::f_packed_bit const> b2{doc.view()["b2"].get_binary()};
+
+    CHECK_THROWS_WITH_CODE(vector::dot(f1, f2), bsoncxx::v_noabi::error_code::k_vector_size_mismatch);
+    CHECK_THROWS_WITH_CODE(vector::l2_distance(f1, f2), bsoncxx::v_noabi::error_code::k_vector_size_mismatch);
+    CHECK_THROWS_WITH_CODE(vector::cosine_similarity(f1, f2), bsoncxx::v_noabi::error_code::k_vector_size_mismatch);
+    CHECK_THROWS_WITH_CODE(vector::dot(i1, i2), bsoncxx::v_noabi::error_code::k_vector_size_mismatch);
+    CHECK_THROWS_WITH_CODE(vector::l2_distance(i1, i2), bsoncxx::v_noabi::error_code::k_vector_size_mismatch);
+    CHECK_THROWS_WITH_CODE(vector::cosine_similarity(i1, i2), bsoncxx::v_noabi::error_code::k_vector_size_mismatch);
+    CHECK_THROWS_WITH_CODE(vector::hamming_distance(b1, b2), bsoncxx::v_noabi::error_code::k_vector_size_mismatch);
+}
+
+TEST_CASE("append vectors in bulk", "[bsoncxx::builder::basic::sub_array]") {
+    using namespace builder::basic;
+
+    SECTION("as consecutive array elements") {
+        bsoncxx::document::value doc = make_document(kvp("vectors", [&](sub_array arr) {
+            arr.append(1);
+            auto vectors = arr.append_vectors(vector::formats::f_float32{}, 3u, 20u);
+            REQUIRE(vectors.size() == 20u);
+            for (std::size_t i = 0u; i < vectors.size(); ++i) {
+                REQUIRE(vectors[i].size() == 3u);
+                std::fill(vectors[i].begin(), vectors[i].end(), float(i));
+            }
+            arr.append(2);
+        }));
+
+        auto const arr = doc.view()["vectors"].get_array().value;
+        CHECK(std::distance(arr.begin(), arr.end()) == 22);
+        CHECK(arr[0].get_int32().value == 1);
+        CHECK(arr[21].get_int32().value == 2);
+
+        BSONCXX_PRIVATE_WARNINGS_PUSH();
+        BSONCXX_PRIVATE_WARNINGS_DISABLE(GNU("-Wfloat-equal"));
+
+        for (std::uint32_t i = 1u; i <= 20u; ++i) {
+            vector::accessor<vector::formats::f_float32 const> vec{arr[i].get_binary()};
+            REQUIRE(vec.size() == 3u);
+            std::for_each(vec.begin(), vec.end(), [&](float value) { CHECK(value == float(i - 1u)); });
+        }
+
+        BSONCXX_PRIVATE_WARNINGS_POP();
+    }
+
+    SECTION("formats packed_bit padding for every vector") {
+        builder::basic::array arr;
+        auto vectors = arr.append_vectors(vector::formats::f_packed_bit{}, 9u, 3u);
+        for (auto& vec : vectors) {
+            std::fill(vec.byte_begin(), vec.byte_end(), UINT8_C(0xFF));
+        }
+
+        auto const view = arr.view();
+        for (auto const& element : view) {
+            types::b_binary const& binary = element.get_binary();
+            std::array<std::uint8_t, 4> expected_bytes{0x10, 7, 0xff, 0x80};
+            binary_eq_bytes(binary, expected_bytes);
+        }
+        CHECK(std::distance(view.begin(), view.end()) == 3);
+    }
+
+    SECTION("appends nothing for zero vectors") {
+        builder::basic::array arr;
+        CHECK(arr.append_vectors(vector::formats::f_int8{}, 4u, 0u).empty());
+        CHECK(arr.view().empty());
+    }
+
+    SECTION("fails to allocate unrepresentably large vectors") {
+        builder::basic::array arr;
+        CHECK_THROWS_WITH_CODE(
+            arr.append_vectors(vector::formats::f_int8{}, SIZE_MAX, 2u),
+            bsoncxx::v_noabi::error_code::k_vector_too_large);
+        CHECK_THROWS_WITH_CODE(
+            arr.append_vectors(vector::formats::f_int8{}, 1u << 20u, 1u << 12u),
+            bsoncxx::v_noabi::error_code::k_cannot_append_binary);
+    }
+}
+
 } // namespace
@@ -0,0 +1,244 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mongocxx/apm_dispatcher-fwd.hpp>
+
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/oid.hpp>
+#include <bsoncxx/stdx/optional.hpp>
+
+#include <mongocxx/events/command_failed_event.hpp>
+#include <mongocxx/events/command_started_event.hpp>
+#include <mongocxx/events/command_succeeded_event.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// Delivers command monitoring events to a listener on a background thread.
+///
+/// Attach a dispatcher to a client or pool with @ref mongocxx::v_noabi::options::apm::dispatcher.
+/// The driver then copies every command started, succeeded, and failed event into an owned
+/// @ref record in a bounded ring buffer and returns to the operation immediately: a slow listener
+/// no longer adds to the latency of operations. A single background thread invokes the listener for
+/// each record in the order the records were posted.
+///
+/// Posting an event takes no lock. When the buffer is full, the event is dropped and counted in
+/// @ref statistics::dropped rather than blocking the operation. Records are reused once delivered,
+/// so posting does not allocate once the buffer has held events of a similar size.
+///
+/// SDAM events are infrequent and are still delivered synchronously to the callbacks of
+/// mongocxx::v_noabi::options::apm.
+///
+class apm_dispatcher {
+   public:
+    ///
+    /// The default number of records the ring buffer can hold.
+    ///
+    static constexpr std::size_t k_default_capacity = 4096;
+
+    ///
+    /// The type of a command monitoring event.
+    ///
+    enum class kind {
+        k_command_started,
+        k_command_succeeded,
+        k_command_failed,
+    };
+
+    ///
+    /// An owned copy of a command monitoring event.
+    ///
+    struct record {
+        ///
+        /// The type of the event.
+        ///
+        kind type;
+
+        ///
+        /// The name of the command.
+        ///
+        std::string command_name;
+
+        ///
+        /// The name of the database. Only set for @ref kind::k_command_started.
+        ///
+        std::string database_name;
+
+        ///
+        /// The host name of the server.
+        ///
+        std::string host;
+
+        ///
+        /// The port of the server.
+        ///
+        std::uint16_t port;
+
+        ///
+        /// The request ID of the command.
+        ///
+        std::int64_t request_id;
+
+        ///
+        /// The operation ID of the command.
+        ///
+        std::int64_t operation_id;
+
+        ///
+        /// The duration of the command in microseconds, or 0 for @ref kind::k_command_started.
+        ///
+        std::int64_t duration;
+
+        ///
+        /// The service ID of the server, if any.
+        ///
+        bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::oid> service_id;
+
+        ///
+        /// The BSON bytes of the command, the reply, or the failure, depending on the type of the
+        /// event. Empty if the dispatcher does not copy documents.
+        ///
+        std::vector<std::uint8_t> document;
+
+        ///
+        /// Returns a view of @ref document, or an empty document if it is empty.
+        ///
+        MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::document::view) document_view() const noexcept;
+    };
+
+    ///
+    /// Delivery counters of an apm_dispatcher.
+    ///
+    struct statistics {
+        ///
+        /// The number of events accepted into the buffer.
+        ///
+        std::uint64_t posted;
+
+        ///
+        /// The number of records passed to the listener.
+        ///
+        std::uint64_t delivered;
+
+        ///
+        /// The number of events dropped because the buffer was full or the event could not be
+        /// copied.
+        ///
+        std::uint64_t dropped;
+    };
+
+    ///
+    /// The listener invoked on the background thread for each record.
+    ///
+    /// The record is only valid for the duration of the call.
+    ///
+    /// If the listener throws an exception, the exception is reported to the standard error stream
+    /// and the record still counts as delivered.
+    ///
+    using listener = std::function<void MONGOCXX_ABI_CDECL(record const& r)>;
+
+    ///
+    /// Starts the background thread.
+    ///
+    /// @param listener
+    ///   The listener invoked for each record.
+    /// @param capacity
+    ///   The number of records the ring buffer can hold, rounded up to a power of two.
+    /// @param copy_documents
+    ///   Whether to copy the command, reply, or failure document into each record. Documents may be
+    ///   large; disable this if the listener only requires the other fields.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::logic_error if the listener is empty or the capacity is 0 or
+    ///   greater than 2^30.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL()
+    apm_dispatcher(listener listener, std::size_t capacity = k_default_capacity, bool copy_documents = true);
+
+    ///
+    /// Delivers the records remaining in the buffer, then stops the background thread.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~apm_dispatcher();
+
+    apm_dispatcher(apm_dispatcher&&) = delete;
+    apm_dispatcher& operator=(apm_dispatcher&&) = delete;
+
+    apm_dispatcher(apm_dispatcher const&) = delete;
+    apm_dispatcher& operator=(apm_dispatcher const&) = delete;
+
+    ///
+    /// Copies an event into the buffer. May be called by any number of threads concurrently.
+    ///
+    /// This is called by the driver for every command monitoring event of a client configured with
+    /// this dispatcher, but may also be called directly.
+    ///
+    /// @return
+    ///   `false` if the event was dropped.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) post(events::command_started_event const& event) noexcept;
+
+    ///
+    /// @copydoc post(events::command_started_event const& event)
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) post(events::command_succeeded_event const& event) noexcept;
+
+    ///
+    /// @copydoc post(events::command_started_event const& event)
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) post(events::command_failed_event const& event) noexcept;
+
+    ///
+    /// Blocks until every event posted before the call has been passed to the listener or dropped.
+    ///
+    /// @warning
+    ///   Must not be called by the listener.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) flush();
+
+    ///
+    /// Returns the number of records the ring buffer can hold.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) capacity() const noexcept;
+
+    ///
+    /// Returns the delivery counters.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(statistics) stats() const noexcept;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::apm_dispatcher.
+///
@@ -0,0 +1,195 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <mongocxx/buffered_change_stream-fwd.hpp>
+#include <mongocxx/options/buffered_change_stream-fwd.hpp>
+
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/stdx/optional.hpp>
+
+#include <mongocxx/change_stream.hpp>
+#include <mongocxx/options/buffered_change_stream.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// A change stream read ahead by a background thread into a bounded queue.
+///
+/// The background thread reads notifications a server batch at a time, as
+/// change_stream::next_batch does, and copies each of them once from the cursor into the queue, so
+/// that network reads continue while consumers are busy. When the queue reaches its capacity, the background thread
+/// stops reading until consumers have drained the queue to its low watermark, so a slow consumer
+/// applies backpressure to the server cursor instead of growing the queue without bound.
+///
+/// The background thread stops at the end of the change stream, i.e. after an `invalidate`
+/// notification or once the server has closed the cursor. Consumers then receive the notifications
+/// still queued, followed by an unset optional.
+///
+/// Notifications may be removed from the queue by any number of threads concurrently. Each
+/// notification is returned to exactly one consumer, in the order of the change stream.
+///
+/// @important The change stream is used by the background thread until this object is destroyed or
+/// @ref stop returns. The client which opened the change stream must not be used by any other
+/// thread in the meantime; use a client acquired from a mongocxx::v_noabi::pool which is dedicated
+/// to the change stream.
+///
+class buffered_change_stream {
+   public:
+    ///
+    /// Counters describing the queue of a buffered_change_stream.
+    ///
+    struct statistics {
+        ///
+        /// The number of notifications currently queued.
+        ///
+        std::size_t depth;
+
+        ///
+        /// The largest number of notifications queued at once.
+        ///
+        std::size_t max_depth;
+
+        ///
+        /// The number of notifications read from the change stream.
+        ///
+        std::uint64_t received;
+
+        ///
+        /// The number of notifications removed from the queue by consumers.
+        ///
+        std::uint64_t consumed;
+
+        ///
+        /// The number of times the background thread stopped reading because the queue was full.
+        ///
+        std::uint64_t full_waits;
+    };
+
+    ///
+    /// Starts reading the given change stream in a background thread.
+    ///
+    /// @param stream
+    ///   The change stream to read.
+    /// @param options
+    ///   Optional arguments, see mongocxx::v_noabi::options::buffered_change_stream.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::logic_error if the capacity is zero or the low watermark is not
+    ///   less than the capacity.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL()
+    buffered_change_stream(change_stream&& stream, options::buffered_change_stream const& options = {});
+
+    ///
+    /// Stops the background thread and destroys the change stream and any queued notifications.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~buffered_change_stream();
+
+    MONGOCXX_ABI_EXPORT_CDECL() buffered_change_stream(buffered_change_stream&&) noexcept;
+    MONGOCXX_ABI_EXPORT_CDECL(buffered_change_stream&) operator=(buffered_change_stream&&) noexcept;
+
+    buffered_change_stream(buffered_change_stream const&) = delete;
+    buffered_change_stream& operator=(buffered_change_stream const&) = delete;
+
+    ///
+    /// Removes the next notification from the queue, waiting until one is available.
+    ///
+    /// @return
+    ///   The notification, or an unset optional if the queue is empty and the background thread has
+    ///   stopped.
+    ///
+    /// @exception
+    ///   Rethrows the exception which stopped the background thread, if any, once the queue is
+    ///   empty.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>) pop();
+
+    ///
+    /// Removes the next notification from the queue, waiting at most the given duration for one to
+    /// be available.
+    ///
+    /// @param timeout
+    ///   The maximum duration to wait.
+    ///
+    /// @return
+    ///   The notification, or an unset optional if none was available in time.
+    ///
+    /// @exception
+    ///   Rethrows the exception which stopped the background thread, if any, once the queue is
+    ///   empty.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>)
+    pop_for(std::chrono::milliseconds timeout);
+
+    ///
+    /// Removes the next notification from the queue without waiting.
+    ///
+    /// @return
+    ///   The notification, or an unset optional if the queue is empty.
+    ///
+    /// @exception
+    ///   Rethrows the exception which stopped the background thread, if any, once the queue is
+    ///   empty.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>) try_pop();
+
+    ///
+    /// Stops the background thread and waits for it to exit.
+    ///
+    /// The background thread notices the request once its current read from the change stream
+    /// returns, i.e. after at most the max_await_time of the change stream options. Notifications
+    /// already queued remain available to consumers.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) stop();
+
+    ///
+    /// Returns whether the background thread has stopped, due to @ref stop, an error, or the end of
+    /// the change stream.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) stopped() const;
+
+    ///
+    /// The number of notifications currently queued.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) depth() const;
+
+    ///
+    /// Returns a snapshot of the queue counters.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(statistics) stats() const;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::buffered_change_stream.
+///
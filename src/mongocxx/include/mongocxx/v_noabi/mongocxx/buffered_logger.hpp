@@ -0,0 +1,166 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <mongocxx/buffered_logger-fwd.hpp>
+
+#include <bsoncxx/stdx/string_view.hpp>
+#include <bsoncxx/string/view_or_value.hpp>
+
+#include <mongocxx/logger.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// A logger which filters log messages and passes the accepted ones to another logger on a
+/// background thread.
+///
+/// The driver calls a logger synchronously on the thread which logs, e.g. while running an
+/// operation. A buffered logger only compares the level and domain of each message against its
+/// filters, copies the accepted messages into a bounded lock-free ring buffer, and returns. A
+/// background thread passes the buffered messages to the wrapped logger. When the buffer is full,
+/// new messages are dropped and counted instead of blocking the thread which logs.
+///
+/// ```cpp
+/// mongocxx::instance instance{std::make_unique<mongocxx::buffered_logger>(
+///     std::make_unique<my_logger>(), mongocxx::log_level::k_debug)};
+/// ```
+///
+/// Messages longer than @ref k_max_message_size bytes are truncated.
+///
+class buffered_logger final : public logger {
+   public:
+    ///
+    /// The default number of messages which may be buffered.
+    ///
+    static constexpr std::size_t k_default_capacity = 1024;
+
+    ///
+    /// The maximum number of bytes of a message which are buffered.
+    ///
+    static constexpr std::size_t k_max_message_size = 4096;
+
+    ///
+    /// The number of messages by outcome since the logger was constructed.
+    ///
+    struct statistics {
+        ///
+        /// The number of messages passed to the wrapped logger.
+        ///
+        std::uint64_t written;
+
+        ///
+        /// The number of accepted messages discarded because the buffer was full.
+        ///
+        std::uint64_t dropped;
+
+        ///
+        /// The number of messages rejected by the level or domain filters.
+        ///
+        std::uint64_t filtered;
+    };
+
+    ///
+    /// Constructs a logger which passes the messages at or above a level to another logger, and
+    /// starts its background thread.
+    ///
+    /// @param sink
+    ///   The logger to pass the accepted messages to.
+    /// @param level
+    ///   The least severe level of the accepted messages, e.g. mongocxx::v_noabi::log_level::k_info
+    ///   accepts every message except debug and trace messages.
+    /// @param capacity
+    ///   The number of messages which may be buffered. Rounded up to a power of two.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::logic_error if the sink is null, or if the capacity is 0 or
+    ///   greater than 2^30.
+    ///
+    explicit buffered_logger(
+        std::unique_ptr<logger> sink,
+        log_level level = log_level::k_info,
+        std::size_t capacity = k_default_capacity);
+
+    ///
+    /// Passes the buffered messages to the wrapped logger, then stops the background thread.
+    ///
+    ~buffered_logger() override;
+
+    buffered_logger(buffered_logger&&) = delete;
+    buffered_logger& operator=(buffered_logger&&) = delete;
+    buffered_logger(buffered_logger const&) = delete;
+    buffered_logger& operator=(buffered_logger const&) = delete;
+
+    void operator()(
+        log_level level,
+        bsoncxx::v_noabi::stdx::string_view domain,
+        bsoncxx::v_noabi::stdx::string_view message) noexcept override;
+
+    ///
+    /// Sets the least severe level of the accepted messages. May be called while the logger is in
+    /// use, e.g. to enable debug logging temporarily.
+    ///
+    void level(log_level level) noexcept;
+
+    ///
+    /// Returns the least severe level of the accepted messages.
+    ///
+    log_level level() const noexcept;
+
+    ///
+    /// Rejects the messages of a domain, e.g. `"cluster"`.
+    ///
+    /// Domains must be ignored before the logger is passed to mongocxx::v_noabi::instance.
+    ///
+    /// @param domain
+    ///   The domain to ignore.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    buffered_logger& ignore_domain(bsoncxx::v_noabi::string::view_or_value domain);
+
+    ///
+    /// Blocks until the messages accepted before the call are passed to the wrapped logger.
+    ///
+    void flush();
+
+    ///
+    /// Returns the number of messages by outcome.
+    ///
+    statistics stats() const noexcept;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::buffered_logger.
+///
@@ -0,0 +1,192 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/change_event-fwd.hpp>
+
+#include <bsoncxx/array/view.hpp>
+#include <bsoncxx/document/element.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/stdx/optional.hpp>
+#include <bsoncxx/stdx/string_view.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// A non-owning, decoded view of a change stream notification.
+///
+/// The well-known fields of a notification (`_id`, `operationType`, `ns`, `documentKey`,
+/// `fullDocument`, `updateDescription` and `clusterTime`) are located in a single pass over the
+/// notification when the change_event is constructed, without allocating. The accessors then
+/// return views of those fields without searching the notification again.
+///
+/// A change_event refers to the memory of the document::view it was constructed from and is only
+/// valid for as long as that memory is, e.g. until the change_stream::iterator it was obtained from
+/// is incremented.
+///
+/// @see
+/// - https://www.mongodb.com/docs/manual/reference/change-events/
+///
+class change_event {
+   public:
+    ///
+    /// The type of operation described by a notification.
+    ///
+    enum class operation_type {
+        ///
+        /// Any operation type not listed below. See @ref operation_name for its name.
+        ///
+        k_other,
+        k_insert,
+        k_update,
+        k_replace,
+        k_delete,
+        k_drop,
+        k_rename,
+        k_drop_database,
+        k_invalidate,
+    };
+
+    ///
+    /// Default-constructs a change_event which refers to no notification.
+    ///
+    change_event() = default;
+
+    ///
+    /// Decodes the well-known fields of a change stream notification.
+    ///
+    /// Fields which are absent or have an unexpected type are treated as absent.
+    ///
+    /// @param event
+    ///   The notification, as returned by a mongocxx::v_noabi::change_stream.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() change_event(bsoncxx::v_noabi::document::view event);
+
+    ///
+    /// The notification this change_event refers to.
+    ///
+    bsoncxx::v_noabi::document::view view() const {
+        return _event;
+    }
+
+    ///
+    /// The resume token (`_id`) of the notification.
+    ///
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::view> const& resume_token() const {
+        return _resume_token;
+    }
+
+    ///
+    /// The type of operation (`operationType`) of the notification.
+    ///
+    operation_type operation() const {
+        return _operation;
+    }
+
+    ///
+    /// The name of the type of operation (`operationType`) of the notification, or an empty string
+    /// if absent.
+    ///
+    bsoncxx::v_noabi::stdx::string_view operation_name() const {
+        return _operation_name;
+    }
+
+    ///
+    /// The database name (`ns.db`) of the notification, or an empty string if absent.
+    ///
+    bsoncxx::v_noabi::stdx::string_view database() const {
+        return _database;
+    }
+
+    ///
+    /// The collection name (`ns.coll`) of the notification, or an empty string if absent.
+    ///
+    bsoncxx::v_noabi::stdx::string_view collection() const {
+        return _collection;
+    }
+
+    ///
+    /// The `documentKey` of the notification.
+    ///
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::view> const& document_key() const {
+        return _document_key;
+    }
+
+    ///
+    /// The `documentKey._id` of the notification.
+    ///
+    /// @return
+    ///   The element, which is invalid (`false` when converted to `bool`) if absent.
+    ///
+    bsoncxx::v_noabi::document::element const& document_key_id() const {
+        return _document_key_id;
+    }
+
+    ///
+    /// The `fullDocument` of the notification.
+    ///
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::view> const& full_document() const {
+        return _full_document;
+    }
+
+    ///
+    /// The `updateDescription.updatedFields` of the notification.
+    ///
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::view> const& updated_fields() const {
+        return _updated_fields;
+    }
+
+    ///
+    /// The `updateDescription.removedFields` of the notification.
+    ///
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::array::view> const& removed_fields() const {
+        return _removed_fields;
+    }
+
+    ///
+    /// The `clusterTime` of the notification.
+    ///
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::types::b_timestamp> const& cluster_time() const {
+        return _cluster_time;
+    }
+
+   private:
+    bsoncxx::v_noabi::document::view _event;
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::view> _resume_token;
+    operation_type _operation = operation_type::k_other;
+    bsoncxx::v_noabi::stdx::string_view _operation_name;
+    bsoncxx::v_noabi::stdx::string_view _database;
+    bsoncxx::v_noabi::stdx::string_view _collection;
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::view> _document_key;
+    bsoncxx::v_noabi::document::element _document_key_id;
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::view> _full_document;
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::view> _updated_fields;
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::array::view> _removed_fields;
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::types::b_timestamp> _cluster_time;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::change_event.
+///
@@ -14,8 +14,12 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
+#include <mongocxx/buffered_change_stream-fwd.hpp>
 #include <mongocxx/change_stream-fwd.hpp>
 #include <mongocxx/client-fwd.hpp>
 #include <mongocxx/collection-fwd.hpp>
@@ -37,6 +41,9 @@ class change_stream {
     /// A change stream iterator.
     class iterator;
 
+    /// A batch of change stream events.
+    class batch;
+
     ///
     /// Move constructs a change_stream.
     ///
@@ -110,7 +117,43 @@ class change_stream {
     MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::view>)
     get_resume_token() const;
 
+    ///
+    /// Returns the next batch of available notifications together with the resume token to
+    /// checkpoint once the whole batch has been processed.
+    ///
+    /// Notifications are consumed from the stream until the last notification of the current
+    /// server batch has been read, no further notifications are available, or `max_events`
+    /// notifications have been read. A `max_events` of zero means no limit other than the server
+    /// batch.
+    ///
+    /// The end of a server batch is only known if the client or pool the stream was opened with
+    /// observes the aggregate and getMore replies, as enabled by
+    /// mongocxx::v_noabi::options::apm::change_stream_batches. Otherwise, reading continues into
+    /// the next server batch, which may wait for the max_await_time, until no further
+    /// notifications are available or `max_events` notifications have been read.
+    ///
+    /// Like change_stream::begin(), this function may block until a notification is available,
+    /// the max_await_time (from the options::change_stream) milliseconds have elapsed, or a server
+    /// error is encountered.
+    ///
+    /// Calling this function invalidates any iterator obtained from begin(). The notification an
+    /// iterator currently points to is considered consumed and is not repeated in the batch.
+    ///
+    /// @param max_events
+    ///   The maximum number of notifications to include in the batch.
+    ///
+    /// @return
+    ///   The batch, which owns copies of the notifications and of the resume token.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::query_exception if the query failed. If notifications were read
+    ///   before the error, they are returned with their resume token first, and the error is
+    ///   thrown by the next call to this function or to begin().
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(batch) next_batch(std::size_t max_events = 1000) const;
+
    private:
+    friend ::mongocxx::v_noabi::buffered_change_stream;
     friend ::mongocxx::v_noabi::client;
     friend ::mongocxx::v_noabi::collection;
     friend ::mongocxx::v_noabi::database;
@@ -221,6 +264,82 @@ class change_stream::iterator {
     change_stream const* _change_stream;
 };
 
+///
+/// A batch of MongoDB change stream notifications.
+///
+/// The batch owns a single contiguous buffer containing every notification, so the views returned
+/// by events() remain valid for the lifetime of the batch (including after it is moved).
+///
+class change_stream::batch {
+   public:
+    ///
+    /// Default-constructs an empty batch.
+    ///
+    batch() = default;
+
+    batch(batch&&) = default;
+    batch& operator=(batch&&) = default;
+
+    batch(batch const&) = delete;
+    batch& operator=(batch const&) = delete;
+
+    ///
+    /// The notifications in this batch, in stream order.
+    ///
+    std::vector<bsoncxx::v_noabi::document::view> const& events() const {
+        return _events;
+    }
+
+    ///
+    /// The resume token observed after the last notification of this batch was read.
+    ///
+    /// This is a postBatchResumeToken when the end of a server batch was reached. Persisting this
+    /// token after processing every notification in the batch is equivalent to persisting the
+    /// token after each notification.
+    ///
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::view> resume_token() const {
+        if (_resume_token.empty()) {
+            return bsoncxx::v_noabi::stdx::nullopt;
+        }
+        return bsoncxx::v_noabi::document::view{_resume_token.data(), _resume_token.size()};
+    }
+
+    ///
+    /// The number of notifications in this batch.
+    ///
+    std::size_t size() const {
+        return _events.size();
+    }
+
+    ///
+    /// True if this batch contains no notifications.
+    ///
+    bool empty() const {
+        return _events.empty();
+    }
+
+    ///
+    /// Iterate over the notifications in this batch.
+    ///
+    /// @{
+    std::vector<bsoncxx::v_noabi::document::view>::const_iterator begin() const {
+        return _events.begin();
+    }
+
+    std::vector<bsoncxx::v_noabi::document::view>::const_iterator end() const {
+        return _events.end();
+    }
+    /// @}
+    ///
+
+   private:
+    friend ::mongocxx::v_noabi::change_stream;
+
+    std::vector<std::uint8_t> _data;
+    std::vector<bsoncxx::v_noabi::document::view> _events;
+    std::vector<std::uint8_t> _resume_token;
+};
+
 } // namespace v_noabi
 } // namespace mongocxx
 
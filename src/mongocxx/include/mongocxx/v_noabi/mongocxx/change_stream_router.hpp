@@ -0,0 +1,238 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include <mongocxx/change_stream_router-fwd.hpp>
+#include <mongocxx/client-fwd.hpp>
+#include <mongocxx/database-fwd.hpp>
+
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/stdx/optional.hpp>
+#include <bsoncxx/stdx/string_view.hpp>
+#include <bsoncxx/string/view_or_value.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <mongocxx/change_event.hpp>
+#include <mongocxx/change_stream.hpp>
+#include <mongocxx/options/change_stream.hpp>
+#include <mongocxx/pipeline.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// Demultiplexes a single database or deployment change stream into per-collection handlers.
+///
+/// Watching many collections with one change stream per collection requires one cursor, and
+/// typically one thread, per collection. Instead, register a handler per collection with
+/// @ref route, open a single change stream with @ref watch, and pass its notifications to
+/// @ref dispatch. The change stream only returns notifications for the routed collections: the
+/// filter is applied by the server as the first stage of the pipeline.
+///
+/// Notifications are routed by their `ns.db` and `ns.coll` fields. Notifications without a
+/// collection (e.g. `dropDatabase` or `invalidate`) are passed to the @ref fallback handler, if
+/// any.
+///
+/// A change_stream_router is not thread-safe: routes must not be added while notifications are
+/// dispatched, and notifications must be dispatched by one thread at a time.
+///
+class change_stream_router {
+   public:
+    ///
+    /// The handler invoked for each notification routed to a collection.
+    ///
+    /// The change_event refers to the notification being dispatched and is only valid for the
+    /// duration of the call.
+    ///
+    using handler = std::function<void MONGOCXX_ABI_CDECL(change_event const& event)>;
+
+    ///
+    /// Delivery counters of a single route.
+    ///
+    struct statistics {
+        ///
+        /// The number of notifications passed to the handler of the route.
+        ///
+        std::uint64_t delivered;
+
+        ///
+        /// The `clusterTime` of the last notification passed to the handler of the route, if any.
+        ///
+        bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::types::b_timestamp> last_cluster_time;
+    };
+
+    MONGOCXX_ABI_EXPORT_CDECL() change_stream_router();
+
+    MONGOCXX_ABI_EXPORT_CDECL() ~change_stream_router();
+
+    MONGOCXX_ABI_EXPORT_CDECL() change_stream_router(change_stream_router&&) noexcept;
+    MONGOCXX_ABI_EXPORT_CDECL(change_stream_router&) operator=(change_stream_router&&) noexcept;
+
+    change_stream_router(change_stream_router const&) = delete;
+    change_stream_router& operator=(change_stream_router const&) = delete;
+
+    ///
+    /// Routes the notifications of a collection to a handler, replacing any previous handler for the
+    /// same collection.
+    ///
+    /// @param database
+    ///   The name of the database containing the collection.
+    /// @param collection
+    ///   The name of the collection.
+    /// @param handler
+    ///   The handler invoked for each notification of the collection.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::logic_error if the database or collection name is empty or the
+    ///   handler is empty.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(change_stream_router&)
+    route(
+        bsoncxx::v_noabi::string::view_or_value database,
+        bsoncxx::v_noabi::string::view_or_value collection,
+        handler handler);
+
+    ///
+    /// Sets the handler invoked for notifications which do not refer to a collection, such as
+    /// `dropDatabase` and `invalidate`.
+    ///
+    /// By default, such notifications are filtered out by the server.
+    ///
+    /// @param handler
+    ///   The handler invoked for each notification without a collection.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(change_stream_router&) fallback(handler handler);
+
+    ///
+    /// The number of routed collections.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) routes() const noexcept;
+
+    ///
+    /// Returns the `$match` filter selecting the notifications of the routed collections.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::document::value) filter() const;
+
+    ///
+    /// Opens a change stream on a database which returns the notifications of the routed
+    /// collections of that database.
+    ///
+    /// @param db
+    ///   The database to watch.
+    /// @param pipe
+    ///   Additional pipeline stages, applied after the routing filter.
+    /// @param options
+    ///   The change stream options.
+    ///
+    /// @return
+    ///   The change stream, whose notifications should be passed to @ref dispatch.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::operation_exception if the operation fails.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(change_stream)
+    watch(database& db, pipeline const& pipe = {}, options::change_stream const& options = {}) const;
+
+    ///
+    /// Opens a change stream on a deployment which returns the notifications of every routed
+    /// collection.
+    ///
+    /// @param client
+    ///   The client to watch with.
+    /// @param pipe
+    ///   Additional pipeline stages, applied after the routing filter.
+    /// @param options
+    ///   The change stream options.
+    ///
+    /// @return
+    ///   The change stream, whose notifications should be passed to @ref dispatch.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::operation_exception if the operation fails.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(change_stream)
+    watch(client& client, pipeline const& pipe = {}, options::change_stream const& options = {}) const;
+
+    ///
+    /// Passes a notification to the handler of its collection.
+    ///
+    /// @param event
+    ///   The notification.
+    ///
+    /// @return
+    ///   Whether a handler was invoked.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) dispatch(bsoncxx::v_noabi::document::view event);
+
+    ///
+    /// Passes every notification of a batch to the handler of its collection, in order.
+    ///
+    /// @param batch
+    ///   The batch of notifications.
+    ///
+    /// @return
+    ///   The number of notifications passed to a handler.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) dispatch(change_stream::batch const& batch);
+
+    ///
+    /// Returns the delivery counters of a collection.
+    ///
+    /// @param database
+    ///   The name of the database containing the collection.
+    /// @param collection
+    ///   The name of the collection.
+    ///
+    /// @return
+    ///   The counters, or an unset optional if the collection is not routed.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::stdx::optional<statistics>)
+    stats(bsoncxx::v_noabi::stdx::string_view database, bsoncxx::v_noabi::stdx::string_view collection) const;
+
+    ///
+    /// The number of dispatched notifications which were not passed to any handler.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::uint64_t) unrouted() const noexcept;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::change_stream_router.
+///
@@ -25,6 +25,8 @@
 #include <mongocxx/options/client_encryption-fwd.hpp>
 #include <mongocxx/pool-fwd.hpp>
 
+#include <bsoncxx/stdx/string_view.hpp>
+
 #include <mongocxx/client_session.hpp>
 #include <mongocxx/database.hpp>
 #include <mongocxx/options/client.hpp>
@@ -227,6 +229,67 @@ class client {
     }
 
     mongocxx::v_noabi::database operator[](bsoncxx::v_noabi::string::view_or_value name) const&& = delete;
+
+    ///
+    /// Obtains a database handle cached by this client.
+    ///
+    /// The first call for a name creates the handle as @ref database does. Later calls for the same
+    /// name return the same handle without allocating, which avoids the cost of creating a handle
+    /// for every request.
+    ///
+    /// The handle is shared by every caller, so changing its @c read_concern, @c read_preference,
+    /// or @c write_concern, renaming it, or assigning to it throws mongocxx::v_noabi::logic_error:
+    /// copy it first, and do not move construct from it. Once the @c read_concern,
+    /// @c read_preference, or @c write_concern of this client is changed, later calls return new
+    /// handles with the new settings.
+    ///
+    /// The handle remains valid until @ref clear_cached_handles is called or this client is
+    /// destroyed. A client acquired from a pool discards its cached handles when it is returned to
+    /// the pool.
+    ///
+    /// @note A database cannot be obtained from a temporary client object.
+    ///
+    /// @param name
+    ///   The name of the database.
+    ///
+    /// @return A reference to the cached database handle.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(mongocxx::v_noabi::database&)
+    cached_database(bsoncxx::v_noabi::stdx::string_view name) &;
+
+    mongocxx::v_noabi::database& cached_database(bsoncxx::v_noabi::stdx::string_view name) && = delete;
+
+    ///
+    /// Obtains a collection handle cached by this client.
+    ///
+    /// The first call for a namespace creates the handle as @ref mongocxx::v_noabi::database::collection
+    /// does. Later calls for the same namespace return the same handle without allocating.
+    ///
+    /// The handle is shared, renewed, and invalidated as described for @ref cached_database.
+    ///
+    /// @note A collection cannot be obtained from a temporary client object.
+    ///
+    /// @param database_name
+    ///   The name of the database.
+    /// @param collection_name
+    ///   The name of the collection.
+    ///
+    /// @return A reference to the cached collection handle.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(mongocxx::v_noabi::collection&)
+    cached_collection(
+        bsoncxx::v_noabi::stdx::string_view database_name,
+        bsoncxx::v_noabi::stdx::string_view collection_name) &;
+
+    mongocxx::v_noabi::collection& cached_collection(
+        bsoncxx::v_noabi::stdx::string_view database_name,
+        bsoncxx::v_noabi::stdx::string_view collection_name) && = delete;
+
+    ///
+    /// Discards the database and collection handles cached by this client. References obtained
+    /// from @ref cached_database and @ref cached_collection are invalidated.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) clear_cached_handles() noexcept;
     ///
     /// Enumerates the databases in the client.
     ///
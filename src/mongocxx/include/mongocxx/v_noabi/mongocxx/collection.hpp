@@ -18,6 +18,7 @@
 #include <string>
 
 #include <mongocxx/bulk_write-fwd.hpp>
+#include <mongocxx/client-fwd.hpp>
 #include <mongocxx/client_encryption-fwd.hpp>
 #include <mongocxx/collection-fwd.hpp>
 #include <mongocxx/database-fwd.hpp>
@@ -114,9 +115,11 @@ class collection {
     MONGOCXX_ABI_EXPORT_CDECL() collection(collection&&) noexcept;
 
     ///
-    /// Move assigns a collection.
+    /// Move assigns a collection. Moving from a collection cached by a client copies it instead.
     ///
-    MONGOCXX_ABI_EXPORT_CDECL(collection&) operator=(collection&&) noexcept;
+    /// @throws mongocxx::v_noabi::logic_error if this collection is cached by a client.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(collection&) operator=(collection&&);
 
     ///
     /// Copy constructs a collection.
@@ -126,6 +129,8 @@ class collection {
     ///
     /// Copy assigns a collection.
     ///
+    /// @throws mongocxx::v_noabi::logic_error if this collection is cached by a client.
+    ///
     MONGOCXX_ABI_EXPORT_CDECL(collection&) operator=(collection const&);
 
     ///
@@ -1289,6 +1294,8 @@ class collection {
     ///
     /// @exception
     ///   mongocxx::v_noabi::operation_exception if the operation fails.
+    /// @exception
+    ///   mongocxx::v_noabi::logic_error if this collection is cached by a client.
     ///
     /// @see
     /// - https://www.mongodb.com/docs/manual/reference/command/renameCollection/
@@ -1316,6 +1323,8 @@ class collection {
     ///
     /// @exception
     ///   mongocxx::v_noabi::operation_exception if the operation fails.
+    /// @exception
+    ///   mongocxx::v_noabi::logic_error if this collection is cached by a client.
     ///
     /// @see
     /// - https://www.mongodb.com/docs/manual/reference/command/renameCollection/
@@ -1871,6 +1880,7 @@ class collection {
 
    private:
     friend ::mongocxx::v_noabi::bulk_write;
+    friend ::mongocxx::v_noabi::client;
     friend ::mongocxx::v_noabi::client_encryption;
     friend ::mongocxx::v_noabi::database;
 
@@ -0,0 +1,156 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <mongocxx/command_filter-fwd.hpp>
+
+#include <bsoncxx/string/view_or_value.hpp>
+
+#include <mongocxx/events/command_failed_event.hpp>
+#include <mongocxx/events/command_started_event.hpp>
+#include <mongocxx/events/command_succeeded_event.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// Selects the command monitoring events delivered to listeners.
+///
+/// Attach a filter to a client or pool with @ref mongocxx::v_noabi::options::apm::filter. The
+/// driver then consults the filter before delivering each command started, succeeded, and failed
+/// event. An event which is filtered out is not delivered to the command monitoring callbacks, the
+/// mongocxx::v_noabi::apm_dispatcher, or the mongocxx::v_noabi::tracing::tracer.
+///
+/// The filter does not apply to the consumers which aggregate over every command, which still see
+/// the events filtered out:
+///
+/// - the mongocxx::v_noabi::command_metrics collector set with
+///   @ref mongocxx::v_noabi::options::apm::metrics,
+/// - the mongocxx::v_noabi::slow_command_log set with @ref mongocxx::v_noabi::options::apm::slow_log,
+///   which copies the command of every started event,
+/// - the mongocxx::v_noabi::server_statistics set with
+///   @ref mongocxx::v_noabi::options::apm::server_stats,
+/// - operation timing, enabled with @ref mongocxx::v_noabi::options::apm::operation_timing,
+/// - change stream batch observation, enabled with
+///   @ref mongocxx::v_noabi::options::apm::change_stream_batches.
+///
+/// An event which is filtered out costs little more than a counter increment only when none of
+/// them is configured.
+///
+/// The events of a command are either all delivered or all filtered out: the succeeded or failed
+/// event of a command follows the decision made for its started event.
+///
+/// The filter must be fully configured before it is attached. Once attached, it may be consulted
+/// by any number of threads concurrently.
+///
+class command_filter {
+   public:
+    MONGOCXX_ABI_EXPORT_CDECL() command_filter();
+
+    MONGOCXX_ABI_EXPORT_CDECL() ~command_filter();
+
+    command_filter(command_filter&&) = delete;
+    command_filter& operator=(command_filter&&) = delete;
+
+    command_filter(command_filter const&) = delete;
+    command_filter& operator=(command_filter const&) = delete;
+
+    ///
+    /// Delivers the events of one command out of every `one_in` commands.
+    ///
+    /// Commands are selected by their request ID, so consecutive commands of a client are sampled
+    /// evenly.
+    ///
+    /// @param one_in
+    ///   The sampling interval. 1 (the default) delivers every command.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::logic_error if `one_in` is 0.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(command_filter&) sample(std::uint32_t one_in);
+
+    ///
+    /// Filters out the events of a command, e.g. `getMore`.
+    ///
+    /// @param command_name
+    ///   The name of the command.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(command_filter&) ignore_command(bsoncxx::v_noabi::string::view_or_value command_name);
+
+    ///
+    /// Adds a database to monitor. Once a database is added, the events of commands run on other
+    /// databases are filtered out.
+    ///
+    /// @param database_name
+    ///   The name of the database.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(command_filter&)
+    monitor_database(bsoncxx::v_noabi::string::view_or_value database_name);
+
+    ///
+    /// Returns whether an event is delivered, and counts it if it is filtered out.
+    ///
+    /// This is called by the driver for every command monitoring event of a client configured with
+    /// this filter. The decision for a succeeded or failed event reuses the decision made for the
+    /// started event of the same command by the same thread.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) accepts(events::command_started_event const& event) noexcept;
+
+    ///
+    /// @copydoc accepts(events::command_started_event const& event)
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) accepts(events::command_succeeded_event const& event) noexcept;
+
+    ///
+    /// @copydoc accepts(events::command_started_event const& event)
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) accepts(events::command_failed_event const& event) noexcept;
+
+    ///
+    /// Returns the number of events filtered out.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::uint64_t) filtered() const noexcept;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::command_filter.
+///
@@ -0,0 +1,170 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mongocxx/command_metrics-fwd.hpp>
+
+#include <bsoncxx/stdx/string_view.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// Aggregates command latency histograms and failure counts from APM events.
+///
+/// Attach a collector to a client or pool with @ref mongocxx::v_noabi::options::apm::metrics. The
+/// driver then records the duration of every succeeded or failed command, keyed by the command
+/// name and the `host:port` of the server, without invoking any user callback.
+///
+/// Each recording thread writes to its own shard with plain atomic stores: no lock is taken and no
+/// memory is allocated once a thread has seen a (command, host) pair. @ref snapshot and
+/// @ref to_prometheus merge the shards of every thread which recorded a command, including threads
+/// which have since exited. The shard of an exited thread is reused by the next new thread which
+/// records a command, so the number of shards is bounded by the number of threads recording at once.
+///
+/// All member functions are thread-safe. A snapshot taken while commands are recorded may include
+/// part of a concurrent recording, e.g. its count but not yet its bucket.
+///
+class command_metrics {
+   public:
+    ///
+    /// The number of histogram buckets, including the final unbounded bucket.
+    ///
+    static constexpr std::size_t k_bucket_count = 18;
+
+    ///
+    /// The aggregated counters of a single (command, host) pair.
+    ///
+    struct series {
+        ///
+        /// The name of the command, e.g. `find`.
+        ///
+        std::string command_name;
+
+        ///
+        /// The server the command was sent to, as `host:port`.
+        ///
+        std::string host;
+
+        ///
+        /// The number of recorded commands, including failures.
+        ///
+        std::uint64_t count;
+
+        ///
+        /// The number of recorded commands which failed.
+        ///
+        std::uint64_t failures;
+
+        ///
+        /// The sum of the durations of the recorded commands, in microseconds.
+        ///
+        std::uint64_t sum_microseconds;
+
+        ///
+        /// The number of recorded commands per bucket of @ref bucket_bounds. Bucket `i` counts the
+        /// durations greater than bound `i - 1` and at most bound `i`; the last bucket counts the
+        /// durations greater than every bound. The counts are not cumulative.
+        ///
+        std::array<std::uint64_t, k_bucket_count> buckets;
+    };
+
+    MONGOCXX_ABI_EXPORT_CDECL() command_metrics();
+
+    MONGOCXX_ABI_EXPORT_CDECL() ~command_metrics();
+
+    command_metrics(command_metrics&&) = delete;
+    command_metrics& operator=(command_metrics&&) = delete;
+
+    command_metrics(command_metrics const&) = delete;
+    command_metrics& operator=(command_metrics const&) = delete;
+
+    ///
+    /// Returns the inclusive upper bounds of the finite histogram buckets, in microseconds.
+    ///
+    /// The bounds range from 50 microseconds to 10 seconds.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(std::array<std::int64_t, k_bucket_count - 1> const&) bucket_bounds() noexcept;
+
+    ///
+    /// Records the duration of one command.
+    ///
+    /// This is called by the driver for every command_succeeded and command_failed event of a
+    /// client configured with this collector, but may also be called directly.
+    ///
+    /// @param command_name
+    ///   The name of the command.
+    /// @param host
+    ///   The server the command was sent to, as `host:port`.
+    /// @param duration_microseconds
+    ///   The duration of the command. Negative durations are recorded as zero.
+    /// @param failed
+    ///   Whether the command failed.
+    ///
+    /// @note
+    ///   The first recording of a (command, host) pair by a thread allocates. If that allocation
+    ///   fails, the recording is dropped.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void)
+    record(
+        bsoncxx::v_noabi::stdx::string_view command_name,
+        bsoncxx::v_noabi::stdx::string_view host,
+        std::int64_t duration_microseconds,
+        bool failed) noexcept;
+
+    ///
+    /// Returns the counters of every recorded (command, host) pair merged across threads.
+    ///
+    /// @return
+    ///   The series, ordered by command name and then host.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::vector<series>) snapshot() const;
+
+    ///
+    /// Returns the counters in the Prometheus text exposition format.
+    ///
+    /// Two metric families are written, labelled with `command` and `host`:
+    /// - `<prefix>_duration_seconds`, a histogram of the command durations.
+    /// - `<prefix>_failures_total`, a counter of the failed commands.
+    ///
+    /// @param prefix
+    ///   The prefix of the metric names.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::string)
+    to_prometheus(bsoncxx::v_noabi::stdx::string_view prefix = "mongocxx_command") const;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::command_metrics.
+///
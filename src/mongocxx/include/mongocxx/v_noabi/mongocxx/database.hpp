@@ -58,9 +58,11 @@ class database {
     MONGOCXX_ABI_EXPORT_CDECL() database(database&&) noexcept;
 
     ///
-    /// Move assigns a database.
+    /// Move assigns a database. Moving from a database cached by a client copies it instead.
     ///
-    MONGOCXX_ABI_EXPORT_CDECL(database&) operator=(database&&) noexcept;
+    /// @throws mongocxx::v_noabi::logic_error if this database is cached by a client.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(database&) operator=(database&&);
 
     ///
     /// Copy constructs a database.
@@ -70,6 +72,8 @@ class database {
     ///
     /// Copy assigns a database.
     ///
+    /// @throws mongocxx::v_noabi::logic_error if this database is cached by a client.
+    ///
     MONGOCXX_ABI_EXPORT_CDECL(database&) operator=(database const&);
 
     ///
@@ -14,12 +14,19 @@
 
 #pragma once
 
+#include <mongocxx/apm_dispatcher-fwd.hpp>
+#include <mongocxx/buffered_change_stream-fwd.hpp>
+#include <mongocxx/buffered_logger-fwd.hpp>
 #include <mongocxx/bulk_write-fwd.hpp>
+#include <mongocxx/change_event-fwd.hpp>
 #include <mongocxx/change_stream-fwd.hpp>
+#include <mongocxx/change_stream_router-fwd.hpp>
 #include <mongocxx/client-fwd.hpp>
 #include <mongocxx/client_encryption-fwd.hpp>
 #include <mongocxx/client_session-fwd.hpp>
 #include <mongocxx/collection-fwd.hpp>
+#include <mongocxx/command_filter-fwd.hpp>
+#include <mongocxx/command_metrics-fwd.hpp>
 #include <mongocxx/cursor-fwd.hpp>
 #include <mongocxx/database-fwd.hpp>
 #include <mongocxx/events/command_failed_event-fwd.hpp>
@@ -61,9 +68,11 @@
 #include <mongocxx/model/update_many-fwd.hpp>
 #include <mongocxx/model/update_one-fwd.hpp>
 #include <mongocxx/model/write-fwd.hpp>
+#include <mongocxx/operation_timer-fwd.hpp>
 #include <mongocxx/options/aggregate-fwd.hpp>
 #include <mongocxx/options/apm-fwd.hpp>
 #include <mongocxx/options/auto_encryption-fwd.hpp>
+#include <mongocxx/options/buffered_change_stream-fwd.hpp>
 #include <mongocxx/options/bulk_write-fwd.hpp>
 #include <mongocxx/options/change_stream-fwd.hpp>
 #include <mongocxx/options/client-fwd.hpp>
@@ -85,6 +94,7 @@
 #include <mongocxx/options/index-fwd.hpp>
 #include <mongocxx/options/index_view-fwd.hpp>
 #include <mongocxx/options/insert-fwd.hpp>
+#include <mongocxx/options/partitioned_change_stream-fwd.hpp>
 #include <mongocxx/options/pool-fwd.hpp>
 #include <mongocxx/options/range-fwd.hpp>
 #include <mongocxx/options/replace-fwd.hpp>
@@ -93,6 +103,7 @@
 #include <mongocxx/options/tls-fwd.hpp>
 #include <mongocxx/options/transaction-fwd.hpp>
 #include <mongocxx/options/update-fwd.hpp>
+#include <mongocxx/partitioned_change_stream-fwd.hpp>
 #include <mongocxx/pipeline-fwd.hpp>
 #include <mongocxx/pool-fwd.hpp>
 #include <mongocxx/read_concern-fwd.hpp>
@@ -107,6 +118,14 @@
 #include <mongocxx/result/update-fwd.hpp>
 #include <mongocxx/search_index_model-fwd.hpp>
 #include <mongocxx/search_index_view-fwd.hpp>
+#include <mongocxx/server_statistics-fwd.hpp>
+#include <mongocxx/slow_command_log-fwd.hpp>
+#include <mongocxx/topology_cache-fwd.hpp>
+#include <mongocxx/tracing/exporter-fwd.hpp>
+#include <mongocxx/tracing/file_exporter-fwd.hpp>
+#include <mongocxx/tracing/memory_exporter-fwd.hpp>
+#include <mongocxx/tracing/span-fwd.hpp>
+#include <mongocxx/tracing/tracer-fwd.hpp>
 #include <mongocxx/uri-fwd.hpp>
 #include <mongocxx/validation_criteria-fwd.hpp>
 #include <mongocxx/write_concern-fwd.hpp>
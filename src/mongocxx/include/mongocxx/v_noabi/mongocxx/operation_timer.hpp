@@ -0,0 +1,135 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include <mongocxx/operation_timer-fwd.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// Breaks down the time the calling thread spends in driver operations into phases.
+///
+/// While a timer exists, the operations run by the thread that constructed it, e.g.
+/// @ref mongocxx::v_noabi::collection::find_one, charge their time to the timer:
+///
+/// ```cpp
+/// mongocxx::operation_timer timer;
+/// auto doc = coll.find_one(filter);
+/// auto phases = timer.phases();
+/// ```
+///
+/// Only the following operations are timed:
+///
+/// - @ref mongocxx::v_noabi::collection::find and @ref mongocxx::v_noabi::collection::find_one,
+/// - @ref mongocxx::v_noabi::bulk_write::execute, including the write operations of
+///   @ref mongocxx::v_noabi::collection which run a bulk write, e.g. `insert_one`,
+/// - advancing a @ref mongocxx::v_noabi::cursor::iterator, including the commands sent to open
+///   the cursor, e.g. the `aggregate` command of @ref mongocxx::v_noabi::collection::aggregate.
+///
+/// The commands run by other operations, e.g. `count_documents` or `run_command`, are neither
+/// charged to the timer nor counted in @ref breakdown::commands.
+///
+/// The time spent in libmongoc includes the time the server took to run the commands, as reported
+/// by command monitoring. That time is only known if the client or pool has operation timing
+/// enabled with @ref mongocxx::v_noabi::options::apm::operation_timing; otherwise it is counted as
+/// driver time.
+///
+/// Timers may be nested: only the most recently constructed timer of a thread records time. The
+/// other timers resume recording once it is destroyed. A timer must be destroyed by the thread
+/// which constructed it, in the reverse order of construction.
+///
+/// When no timer exists, the driver takes no timestamps.
+///
+class operation_timer {
+   public:
+    ///
+    /// The time spent in each phase of the recorded operations.
+    ///
+    struct breakdown {
+        ///
+        /// The time spent building commands and their options in C++.
+        ///
+        std::chrono::nanoseconds prepare;
+
+        ///
+        /// The time spent in libmongoc other than waiting for replies: server selection,
+        /// connection checkout, and encoding and decoding messages.
+        ///
+        std::chrono::nanoseconds driver;
+
+        ///
+        /// The time between sending each command and receiving its reply, as reported by command
+        /// monitoring: network round trips and the time the server spent running the commands.
+        ///
+        std::chrono::nanoseconds server;
+
+        ///
+        /// The time spent handling replies and results in C++.
+        ///
+        std::chrono::nanoseconds results;
+
+        ///
+        /// The number of commands sent to servers, as reported by command monitoring.
+        ///
+        std::uint32_t commands;
+    };
+
+    ///
+    /// Starts recording the operations of the calling thread.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() operation_timer();
+
+    ///
+    /// Stops recording and resumes the previous timer of the thread, if any.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~operation_timer();
+
+    operation_timer(operation_timer&&) = delete;
+    operation_timer& operator=(operation_timer&&) = delete;
+
+    operation_timer(operation_timer const&) = delete;
+    operation_timer& operator=(operation_timer const&) = delete;
+
+    ///
+    /// Returns the time recorded since the timer was constructed or last reset.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(breakdown) phases() const noexcept;
+
+    ///
+    /// Discards the time recorded so far, e.g. between two operations.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) reset() noexcept;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::operation_timer.
+///
@@ -15,9 +15,18 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #include <mongocxx/options/apm-fwd.hpp>
 
+#include <mongocxx/apm_dispatcher-fwd.hpp>
+#include <mongocxx/command_filter-fwd.hpp>
+#include <mongocxx/command_metrics-fwd.hpp>
+#include <mongocxx/server_statistics-fwd.hpp>
+#include <mongocxx/slow_command_log-fwd.hpp>
+#include <mongocxx/topology_cache-fwd.hpp>
+#include <mongocxx/tracing/tracer-fwd.hpp>
+
 #include <mongocxx/events/command_failed_event.hpp>
 #include <mongocxx/events/command_started_event.hpp>
 #include <mongocxx/events/command_succeeded_event.hpp>
@@ -352,6 +361,202 @@ class apm {
     MONGOCXX_ABI_EXPORT_CDECL(std::function<void MONGOCXX_ABI_CDECL(events::heartbeat_succeeded_event const&)> const&)
     heartbeat_succeeded() const;
 
+    ///
+    /// Set the collector of command latency histograms. The driver records the duration of every
+    /// succeeded and failed command in the collector, in addition to invoking the command succeeded
+    /// and command failed monitoring callbacks, if any.
+    ///
+    /// @param metrics
+    ///   The collector, or a null pointer to disable recording. The collector may be shared by
+    ///   several clients and pools.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called.  This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(apm&) metrics(std::shared_ptr<command_metrics> metrics);
+
+    ///
+    /// Retrieves the collector of command latency histograms.
+    ///
+    /// @return The collector, or a null pointer if none is set.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::shared_ptr<command_metrics> const&) metrics() const;
+
+    ///
+    /// Set the dispatcher which delivers command monitoring events on a background thread. The
+    /// driver posts a copy of every command started, succeeded, and failed event to the dispatcher,
+    /// in addition to invoking the corresponding monitoring callbacks, if any.
+    ///
+    /// @param dispatcher
+    ///   The dispatcher, or a null pointer to disable asynchronous delivery. The dispatcher may be
+    ///   shared by several clients and pools.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called.  This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(apm&) dispatcher(std::shared_ptr<apm_dispatcher> dispatcher);
+
+    ///
+    /// Retrieves the dispatcher which delivers command monitoring events on a background thread.
+    ///
+    /// @return The dispatcher, or a null pointer if none is set.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::shared_ptr<apm_dispatcher> const&) dispatcher() const;
+
+    ///
+    /// Set the filter which selects the command monitoring events delivered to the command started,
+    /// succeeded, and failed monitoring callbacks and to the dispatcher.
+    ///
+    /// @param filter
+    ///   The filter, or a null pointer to deliver every event. The filter may be shared by several
+    ///   clients and pools.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called.  This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(apm&) filter(std::shared_ptr<command_filter> filter);
+
+    ///
+    /// Retrieves the filter which selects the command monitoring events delivered to listeners.
+    ///
+    /// @return The filter, or a null pointer if none is set.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::shared_ptr<command_filter> const&) filter() const;
+
+    ///
+    /// Set the tracer which pairs command monitoring events into spans. The tracer only receives the
+    /// events selected by the filter, if any.
+    ///
+    /// @param tracer
+    ///   The tracer, or a null pointer to disable tracing. The tracer may be shared by several
+    ///   clients and pools.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called.  This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(apm&) tracer(std::shared_ptr<tracing::tracer> tracer);
+
+    ///
+    /// Retrieves the tracer which pairs command monitoring events into spans.
+    ///
+    /// @return The tracer, or a null pointer if none is set.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::shared_ptr<tracing::tracer> const&) tracer() const;
+
+    ///
+    /// Set the log of the commands slower than a threshold. The driver passes every command
+    /// started, succeeded, and failed event to the log, regardless of the filter, if any.
+    ///
+    /// @param slow_log
+    ///   The log, or a null pointer to disable it. The log may be shared by several clients and
+    ///   pools.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called.  This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(apm&) slow_log(std::shared_ptr<slow_command_log> slow_log);
+
+    ///
+    /// Retrieves the log of the commands slower than a threshold.
+    ///
+    /// @return The log, or a null pointer if none is set.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::shared_ptr<slow_command_log> const&) slow_log() const;
+
+    ///
+    /// Set whether the durations of commands are reported to the mongocxx::v_noabi::operation_timer
+    /// of the thread running them, if any, to separate the time spent waiting for servers from the
+    /// time spent in the driver.
+    ///
+    /// @param enabled
+    ///   Whether to report command durations. Defaults to false.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called.  This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(apm&) operation_timing(bool enabled);
+
+    ///
+    /// Retrieves whether the durations of commands are reported to operation timers.
+    ///
+    /// @return Whether command durations are reported.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) operation_timing() const;
+
+    ///
+    /// Set whether the size of each batch of change stream events returned by the server is
+    /// observed, so that mongocxx::v_noabi::change_stream::next_batch returns at the end of a server
+    /// batch instead of reading into the next one.
+    ///
+    /// The sizes are taken from the replies reported by command monitoring, which is enabled for
+    /// every command of the client or pool. They are also observed whenever another option of this
+    /// object monitors succeeded commands, e.g. @ref metrics or @ref command_succeeded.
+    ///
+    /// @param enabled
+    ///   Whether to observe the size of change stream batches. Defaults to false.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called.  This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(apm&) change_stream_batches(bool enabled);
+
+    ///
+    /// Retrieves whether the size of change stream batches is observed.
+    ///
+    /// @return Whether the size of change stream batches is observed.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) change_stream_batches() const;
+
+    ///
+    /// Set the cache which keeps a snapshot of the topology. The driver passes every topology
+    /// changed, topology closed, and heartbeat succeeded event to the cache.
+    ///
+    /// @param cache
+    ///   The cache, or a null pointer to disable it. The cache should not be shared by several
+    ///   clients or pools.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called.  This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(apm&) cached_topology(std::shared_ptr<topology_cache> cache);
+
+    ///
+    /// Retrieves the cache which keeps a snapshot of the topology.
+    ///
+    /// @return The cache, or a null pointer if none is set.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::shared_ptr<topology_cache> const&) cached_topology() const;
+
+    ///
+    /// Set the statistics kept per server. The driver passes every command started, succeeded, and
+    /// failed event, regardless of the filter, if any, and every heartbeat succeeded and failed
+    /// event to the statistics.
+    ///
+    /// @param stats
+    ///   The statistics, or a null pointer to disable them. The statistics may be shared by several
+    ///   clients and pools.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called.  This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(apm&) server_stats(std::shared_ptr<server_statistics> stats);
+
+    ///
+    /// Retrieves the statistics kept per server.
+    ///
+    /// @return The statistics, or a null pointer if none are set.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::shared_ptr<server_statistics> const&) server_stats() const;
+
    private:
     std::function<void MONGOCXX_ABI_CDECL(events::command_started_event const&)> _command_started;
     std::function<void MONGOCXX_ABI_CDECL(events::command_failed_event const&)> _command_failed;
@@ -365,6 +570,15 @@ class apm {
     std::function<void MONGOCXX_ABI_CDECL(events::heartbeat_started_event const&)> _heartbeat_started;
     std::function<void MONGOCXX_ABI_CDECL(events::heartbeat_failed_event const&)> _heartbeat_failed;
     std::function<void MONGOCXX_ABI_CDECL(events::heartbeat_succeeded_event const&)> _heartbeat_succeeded;
+    std::shared_ptr<command_metrics> _metrics;
+    std::shared_ptr<apm_dispatcher> _dispatcher;
+    std::shared_ptr<command_filter> _filter;
+    std::shared_ptr<tracing::tracer> _tracer;
+    std::shared_ptr<slow_command_log> _slow_log;
+    bool _operation_timing = false;
+    bool _change_stream_batches = false;
+    std::shared_ptr<topology_cache> _cached_topology;
+    std::shared_ptr<server_statistics> _server_stats;
 };
 
 } // namespace options
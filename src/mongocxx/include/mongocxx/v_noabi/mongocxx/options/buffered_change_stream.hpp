@@ -0,0 +1,98 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+
+#include <mongocxx/options/buffered_change_stream-fwd.hpp>
+
+#include <bsoncxx/stdx/optional.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace options {
+
+///
+/// Used by @ref mongocxx::v_noabi::buffered_change_stream.
+///
+class buffered_change_stream {
+   public:
+    MONGOCXX_ABI_EXPORT_CDECL() buffered_change_stream();
+
+    ///
+    /// Sets the maximum number of notifications held in the queue.
+    ///
+    /// Once the queue is full, the background thread stops reading from the change stream until the
+    /// queue has drained to the @ref low_watermark. The default is 1024.
+    ///
+    /// @param capacity
+    ///   The maximum number of queued notifications. Must be greater than zero.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(buffered_change_stream&) capacity(std::size_t capacity);
+
+    ///
+    /// The current capacity.
+    ///
+    /// @return
+    ///   The current capacity.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::stdx::optional<std::size_t> const&) capacity() const;
+
+    ///
+    /// Sets the number of queued notifications at or below which the background thread resumes
+    /// reading after the queue was full.
+    ///
+    /// A low watermark well below the capacity lets the background thread read whole server batches
+    /// rather than one notification at a time while consumers are slower than the stream. The
+    /// default is half the capacity.
+    ///
+    /// @param low_watermark
+    ///   The number of queued notifications. Must be less than the capacity.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(buffered_change_stream&) low_watermark(std::size_t low_watermark);
+
+    ///
+    /// The current low watermark.
+    ///
+    /// @return
+    ///   The current low watermark.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::stdx::optional<std::size_t> const&) low_watermark() const;
+
+   private:
+    bsoncxx::v_noabi::stdx::optional<std::size_t> _capacity;
+    bsoncxx::v_noabi::stdx::optional<std::size_t> _low_watermark;
+};
+
+} // namespace options
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::options::buffered_change_stream.
+///
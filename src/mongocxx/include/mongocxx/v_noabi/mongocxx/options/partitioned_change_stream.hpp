@@ -0,0 +1,159 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <mongocxx/options/partitioned_change_stream-fwd.hpp>
+
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/stdx/optional.hpp>
+
+#include <mongocxx/options/change_stream.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace options {
+
+///
+/// Used by @ref mongocxx::v_noabi::partitioned_change_stream.
+///
+class partitioned_change_stream {
+   public:
+    MONGOCXX_ABI_EXPORT_CDECL() partitioned_change_stream();
+
+    ///
+    /// Sets the number of partitions (and worker threads) the change stream is split into.
+    ///
+    /// The default is the number of concurrent threads supported by the implementation, or 1 if
+    /// that number is not computable.
+    ///
+    /// Notifications are assigned to partitions with the `$toHashedIndexKey` aggregation operator,
+    /// which requires MongoDB 7.0 or later, even with a single partition.
+    ///
+    /// @param partitions
+    ///   The number of partitions. Must be greater than zero.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(partitioned_change_stream&) partitions(std::size_t partitions);
+
+    ///
+    /// The current number of partitions.
+    ///
+    /// @return
+    ///   The current number of partitions.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::stdx::optional<std::size_t> const&) partitions() const;
+
+    ///
+    /// Sets the options used to open the change stream of each partition.
+    ///
+    /// Each partition stream is opened with these options. When a resume token is set for a
+    /// partition with @ref resume_tokens, it is used as the resumeAfter option of that partition
+    /// instead.
+    ///
+    /// @param change_stream_opts
+    ///   The change stream options.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(partitioned_change_stream&)
+    change_stream_opts(change_stream change_stream_opts);
+
+    ///
+    /// The current change stream options.
+    ///
+    /// @return
+    ///   The current change stream options.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(change_stream const&) change_stream_opts() const;
+
+    ///
+    /// Sets the per-partition resume tokens to restart from.
+    ///
+    /// The tokens are typically those previously returned by
+    /// mongocxx::v_noabi::partitioned_change_stream::resume_tokens for the same number of
+    /// partitions. A partition without a token starts according to @ref change_stream_opts.
+    ///
+    /// @param resume_tokens
+    ///   One optional resume token per partition.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(partitioned_change_stream&)
+    resume_tokens(std::vector<bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>> resume_tokens);
+
+    ///
+    /// The current per-partition resume tokens.
+    ///
+    /// @return
+    ///   The current per-partition resume tokens.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(
+        std::vector<bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>> const&)
+    resume_tokens() const;
+
+    ///
+    /// Sets the maximum number of notifications delivered to the handler in a single batch.
+    ///
+    /// The default is to not limit the size of a batch beyond the size of a server batch.
+    ///
+    /// @param max_batch_events
+    ///   The maximum number of notifications per batch.
+    ///
+    /// @return
+    ///   A reference to the object on which this member function is being called. This facilitates
+    ///   method chaining.
+    ///
+    /// @see
+    /// - @ref mongocxx::v_noabi::change_stream::next_batch
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(partitioned_change_stream&) max_batch_events(std::size_t max_batch_events);
+
+    ///
+    /// The current maximum number of notifications per batch.
+    ///
+    /// @return
+    ///   The current maximum number of notifications per batch.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::stdx::optional<std::size_t> const&) max_batch_events() const;
+
+   private:
+    bsoncxx::v_noabi::stdx::optional<std::size_t> _partitions;
+    change_stream _change_stream_opts;
+    std::vector<bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>> _resume_tokens;
+    bsoncxx::v_noabi::stdx::optional<std::size_t> _max_batch_events;
+};
+
+} // namespace options
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::options::partitioned_change_stream.
+///
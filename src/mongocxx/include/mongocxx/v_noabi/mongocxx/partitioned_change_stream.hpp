@@ -0,0 +1,184 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <mongocxx/options/partitioned_change_stream-fwd.hpp>
+#include <mongocxx/partitioned_change_stream-fwd.hpp>
+#include <mongocxx/pipeline-fwd.hpp>
+#include <mongocxx/pool-fwd.hpp>
+
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/stdx/optional.hpp>
+#include <bsoncxx/string/view_or_value.hpp>
+
+#include <mongocxx/change_stream.hpp>
+#include <mongocxx/options/partitioned_change_stream.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// A change stream on a collection that is split into partitions consumed in parallel.
+///
+/// Each partition is a separate change stream, opened with a client acquired from a
+/// mongocxx::v_noabi::pool and consumed by its own worker thread. A partition holds its client
+/// while it runs, so the `maxPoolSize` of the pool must be at least the number of partitions, plus
+/// the clients used concurrently by the rest of the application. Notifications are assigned to
+/// partitions by a server-side `$match` on the hash of `documentKey._id`, so every notification for
+/// a given document is delivered, in order, to the same partition. Notifications without a
+/// `documentKey` (e.g. `drop` or `invalidate`) are delivered to every partition.
+///
+/// The `$match` filter hashes with the `$toHashedIndexKey` aggregation operator, which requires
+/// MongoDB 7.0 or later. On older servers, opening the change stream of a partition fails: every
+/// partition is stopped and the error is rethrown by @ref stop.
+///
+/// Notifications are delivered to a handler one @ref change_stream::batch at a time. The resume
+/// token of a partition only advances once the handler has returned for a batch, so the tokens
+/// returned by @ref resume_tokens may be persisted and used to restart every partition without
+/// losing notifications.
+///
+class partitioned_change_stream {
+   public:
+    ///
+    /// The handler invoked by the worker thread of a partition for each non-empty batch of
+    /// notifications.
+    ///
+    /// The handler is invoked concurrently for different partitions, but never concurrently for the
+    /// same partition. If it throws, every partition is stopped and the exception is rethrown by
+    /// @ref stop.
+    ///
+    using batch_handler =
+        std::function<void MONGOCXX_ABI_CDECL(std::size_t partition, change_stream::batch const& batch)>;
+
+    ///
+    /// Creates a partitioned change stream on the given collection. No change stream is opened
+    /// until @ref start is called.
+    ///
+    /// @param pool
+    ///   The pool from which each partition acquires a client. Must outlive this object.
+    /// @param database
+    ///   The name of the database containing the collection to watch.
+    /// @param collection
+    ///   The name of the collection to watch.
+    /// @param pipe
+    ///   The pipeline applied to every partition after partitioning.
+    /// @param handler
+    ///   The handler invoked for each batch of notifications.
+    /// @param options
+    ///   Optional arguments, see mongocxx::v_noabi::options::partitioned_change_stream.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::logic_error if the number of partitions is zero or does not match
+    ///   the number of resume tokens.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL()
+    partitioned_change_stream(
+        pool& pool,
+        bsoncxx::v_noabi::string::view_or_value database,
+        bsoncxx::v_noabi::string::view_or_value collection,
+        pipeline const& pipe,
+        batch_handler handler,
+        options::partitioned_change_stream const& options = {});
+
+    ///
+    /// Stops every partition and waits for the worker threads to exit.
+    ///
+    /// Any error raised by a partition and not yet reported by @ref stop is discarded.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~partitioned_change_stream();
+
+    MONGOCXX_ABI_EXPORT_CDECL() partitioned_change_stream(partitioned_change_stream&&) noexcept;
+    MONGOCXX_ABI_EXPORT_CDECL(partitioned_change_stream&) operator=(partitioned_change_stream&&) noexcept;
+
+    partitioned_change_stream(partitioned_change_stream const&) = delete;
+    partitioned_change_stream& operator=(partitioned_change_stream const&) = delete;
+
+    ///
+    /// Starts one worker thread per partition.
+    ///
+    /// Partitions resume from the latest resume tokens, so a partitioned_change_stream may be
+    /// restarted after @ref stop.
+    ///
+    /// A client is acquired from the pool for every partition before any worker thread is started.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::logic_error if the partitions are already running, or if the pool
+    ///   does not have an available client for every partition.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) start();
+
+    ///
+    /// Requests every partition to stop and waits for the worker threads to exit.
+    ///
+    /// A worker thread notices the request once its current call to
+    /// change_stream::next_batch returns, i.e. after at most the max_await_time of the change
+    /// stream options.
+    ///
+    /// @exception
+    ///   Rethrows the first exception raised by a partition, if any.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) stop();
+
+    ///
+    /// The number of partitions.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) partitions() const noexcept;
+
+    ///
+    /// Returns a copy of the resume token of each partition, indexed by partition.
+    ///
+    /// The token of a partition is the resume token observed after the last batch fully processed
+    /// by the handler. These tokens may be passed to
+    /// mongocxx::v_noabi::options::partitioned_change_stream::resume_tokens to restart the
+    /// partitions.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::vector<bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>>)
+    resume_tokens() const;
+
+    ///
+    /// Returns the `$match` filter selecting the notifications of one partition.
+    ///
+    /// The filter uses the `$toHashedIndexKey` aggregation operator, which requires MongoDB 7.0 or
+    /// later.
+    ///
+    /// @param partition
+    ///   The index of the partition.
+    /// @param partitions
+    ///   The total number of partitions.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::document::value)
+        partition_filter(std::size_t partition, std::size_t partitions);
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::partitioned_change_stream.
+///
@@ -0,0 +1,239 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mongocxx/server_statistics-fwd.hpp>
+
+#include <bsoncxx/stdx/optional.hpp>
+#include <bsoncxx/stdx/string_view.hpp>
+
+#include <mongocxx/events/command_failed_event.hpp>
+#include <mongocxx/events/command_started_event.hpp>
+#include <mongocxx/events/command_succeeded_event.hpp>
+#include <mongocxx/events/heartbeat_failed_event.hpp>
+#include <mongocxx/events/heartbeat_succeeded_event.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// Keeps rolling statistics of each server a client or pool talks to: round-trip times, heartbeat
+/// failures, commands in flight, command durations, and bytes exchanged.
+///
+/// Attach the statistics to a client or pool with
+/// @ref mongocxx::v_noabi::options::apm::server_stats. The driver then passes every command
+/// started, succeeded, and failed event, regardless of the filter, if any, and every heartbeat
+/// succeeded and failed event to the statistics.
+///
+/// Round-trip times are measured by the heartbeats which are not awaited. Servers monitored with the
+/// streaming protocol therefore have no round-trip time; their command durations reflect their
+/// latency instead.
+///
+/// Percentiles are computed over the most recent samples of each server, @ref k_rtt_samples
+/// round-trip times and @ref k_duration_samples command durations. Recording a command does not
+/// lock or allocate once its server is known. Servers removed from the topology are kept.
+///
+/// All member functions are thread-safe.
+///
+class server_statistics {
+   public:
+    ///
+    /// The number of round-trip times kept per server.
+    ///
+    static constexpr std::size_t k_rtt_samples = 32;
+
+    ///
+    /// The number of command durations kept per server.
+    ///
+    static constexpr std::size_t k_duration_samples = 256;
+
+    ///
+    /// Percentiles of recent samples, or zero if there are none.
+    ///
+    struct percentiles {
+        ///
+        /// The number of samples the percentiles are computed over.
+        ///
+        std::size_t samples;
+
+        ///
+        /// The median.
+        ///
+        std::chrono::microseconds p50;
+
+        ///
+        /// The 90th percentile.
+        ///
+        std::chrono::microseconds p90;
+
+        ///
+        /// The 99th percentile.
+        ///
+        std::chrono::microseconds p99;
+    };
+
+    ///
+    /// The statistics of a server.
+    ///
+    struct server {
+        ///
+        /// The host name of the server.
+        ///
+        std::string host;
+
+        ///
+        /// The port of the server.
+        ///
+        std::uint16_t port;
+
+        ///
+        /// The exponentially weighted moving average of the round-trip times, with a weighting
+        /// factor of 0.2 as in the server discovery and monitoring specification, or -1 if unknown.
+        ///
+        std::chrono::microseconds round_trip_time;
+
+        ///
+        /// Percentiles of the recent round-trip times.
+        ///
+        percentiles round_trip_times;
+
+        ///
+        /// The number of successful heartbeats.
+        ///
+        std::uint64_t heartbeats_succeeded;
+
+        ///
+        /// The number of failed heartbeats.
+        ///
+        std::uint64_t heartbeats_failed;
+
+        ///
+        /// The number of heartbeats failed since the last successful one.
+        ///
+        std::uint64_t consecutive_heartbeat_failures;
+
+        ///
+        /// The number of commands started and not yet completed.
+        ///
+        std::int64_t commands_in_flight;
+
+        ///
+        /// The number of commands succeeded.
+        ///
+        std::uint64_t commands_succeeded;
+
+        ///
+        /// The number of commands failed.
+        ///
+        std::uint64_t commands_failed;
+
+        ///
+        /// Percentiles of the recent command durations, as measured by the driver.
+        ///
+        percentiles command_durations;
+
+        ///
+        /// The total size in bytes of the commands sent, as BSON documents.
+        ///
+        std::uint64_t bytes_sent;
+
+        ///
+        /// The total size in bytes of the replies received, as BSON documents.
+        ///
+        std::uint64_t bytes_received;
+    };
+
+    ///
+    /// Constructs statistics without servers.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() server_statistics();
+
+    MONGOCXX_ABI_EXPORT_CDECL() ~server_statistics();
+
+    server_statistics(server_statistics&&) = delete;
+    server_statistics& operator=(server_statistics&&) = delete;
+
+    server_statistics(server_statistics const&) = delete;
+    server_statistics& operator=(server_statistics const&) = delete;
+
+    ///
+    /// Records a command sent to a server.
+    ///
+    /// This is called by the driver for every command started event of a client configured with
+    /// these statistics.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) record(events::command_started_event const& event) noexcept;
+
+    ///
+    /// Records the completion of a command.
+    ///
+    /// This is called by the driver for every command succeeded or failed event of a client
+    /// configured with these statistics.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) record(events::command_succeeded_event const& event) noexcept;
+
+    ///
+    /// @copydoc record(events::command_succeeded_event const& event)
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) record(events::command_failed_event const& event) noexcept;
+
+    ///
+    /// Records a heartbeat. The duration of a heartbeat which is not awaited is recorded as a
+    /// round-trip time.
+    ///
+    /// This is called by the driver for every heartbeat succeeded or failed event of a client
+    /// configured with these statistics.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) record(events::heartbeat_succeeded_event const& event) noexcept;
+
+    ///
+    /// @copydoc record(events::heartbeat_succeeded_event const& event)
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) record(events::heartbeat_failed_event const& event) noexcept;
+
+    ///
+    /// Returns the statistics of every server seen so far, ordered by host and port.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::vector<server>) servers() const;
+
+    ///
+    /// Returns the statistics of a server, if it was seen.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v_noabi::stdx::optional<server>)
+    find(bsoncxx::v_noabi::stdx::string_view host, std::uint16_t port) const;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::server_statistics.
+///
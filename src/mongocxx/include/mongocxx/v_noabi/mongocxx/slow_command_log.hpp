@@ -0,0 +1,213 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mongocxx/slow_command_log-fwd.hpp>
+
+#include <bsoncxx/document/value.hpp>
+
+#include <mongocxx/events/command_failed_event.hpp>
+#include <mongocxx/events/command_started_event.hpp>
+#include <mongocxx/events/command_succeeded_event.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// Records the commands slower than a threshold, with the shape of each command.
+///
+/// Attach a log to a client or pool with @ref mongocxx::v_noabi::options::apm::slow_log. The
+/// driver then passes every command started, succeeded, and failed event to the log, regardless of
+/// the filter, if any.
+///
+/// The shape of a command is the command with every value replaced by the name of its BSON type,
+/// e.g. `{"find": "string", "filter": {"age": {"$gt": "int32"}}}`. Only the first element of each
+/// array is kept, nesting is limited, and the fields added by the driver (`lsid`, `$db`,
+/// `$clusterTime`, etc.) are omitted. The shape identifies the query without exposing its values.
+///
+/// Memory is bounded: the log keeps the slowest commands of the current window and of the previous
+/// window, at most `top_k` of each. Commands faster than the threshold cost a copy of the command
+/// when it starts and a comparison when it completes.
+///
+/// All member functions are thread-safe.
+///
+class slow_command_log {
+   public:
+    ///
+    /// A command slower than the threshold.
+    ///
+    struct entry {
+        ///
+        /// The name of the command, e.g. `find`.
+        ///
+        std::string command_name;
+
+        ///
+        /// The name of the database the command was run on.
+        ///
+        std::string database_name;
+
+        ///
+        /// The name of the collection the command applies to, or empty if the command does not
+        /// apply to a collection.
+        ///
+        std::string collection_name;
+
+        ///
+        /// The host name of the server.
+        ///
+        std::string host;
+
+        ///
+        /// The port of the server.
+        ///
+        std::uint16_t port;
+
+        ///
+        /// The shape of the command.
+        ///
+        bsoncxx::v_noabi::document::value shape;
+
+        ///
+        /// The time at which the command was started.
+        ///
+        std::chrono::system_clock::time_point start_time;
+
+        ///
+        /// The duration of the command as measured by the driver.
+        ///
+        std::chrono::microseconds duration;
+
+        ///
+        /// The size in bytes of the reply of the server, or of the failure document if the command
+        /// failed.
+        ///
+        std::size_t reply_size;
+
+        ///
+        /// Whether the command failed.
+        ///
+        bool failed;
+
+        ///
+        /// The request ID of the command.
+        ///
+        std::int64_t request_id;
+
+        ///
+        /// The operation ID of the command.
+        ///
+        std::int64_t operation_id;
+    };
+
+    ///
+    /// Constructs a log of the commands slower than a threshold.
+    ///
+    /// @param threshold
+    ///   The duration at or above which a command is recorded.
+    /// @param top_k
+    ///   The number of commands kept per window.
+    /// @param window
+    ///   The length of a window.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::logic_error if `threshold` is negative, `top_k` is 0, or
+    ///   `window` is not positive.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL()
+    slow_command_log(
+        std::chrono::microseconds threshold,
+        std::size_t top_k = 10,
+        std::chrono::seconds window = std::chrono::seconds{60});
+
+    MONGOCXX_ABI_EXPORT_CDECL() ~slow_command_log();
+
+    slow_command_log(slow_command_log&&) = delete;
+    slow_command_log& operator=(slow_command_log&&) = delete;
+
+    slow_command_log(slow_command_log const&) = delete;
+    slow_command_log& operator=(slow_command_log const&) = delete;
+
+    ///
+    /// Remembers a command until it completes.
+    ///
+    /// This is called by the driver for every command started event of a client configured with
+    /// this log.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) start(events::command_started_event const& event) noexcept;
+
+    ///
+    /// Records a command started by the same thread if it is slower than the threshold. Ignored if
+    /// the command was not started.
+    ///
+    /// This is called by the driver for every command succeeded or failed event of a client
+    /// configured with this log.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) finish(events::command_succeeded_event const& event) noexcept;
+
+    ///
+    /// @copydoc finish(events::command_succeeded_event const& event)
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) finish(events::command_failed_event const& event) noexcept;
+
+    ///
+    /// Returns the slowest commands of the current window, slowest first.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::vector<entry>) slowest() const;
+
+    ///
+    /// Returns the slowest commands of the previous window, slowest first. Empty if no command was
+    /// recorded in the window immediately preceding the current one.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::vector<entry>) previous_slowest() const;
+
+    ///
+    /// Returns the number of commands slower than the threshold, including those no longer kept.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::uint64_t) slow_count() const noexcept;
+
+    ///
+    /// Returns the threshold.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::chrono::microseconds) threshold() const noexcept;
+
+    ///
+    /// Discards the recorded commands and resets the count.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) clear();
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::slow_command_log.
+///
@@ -0,0 +1,216 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <mongocxx/topology_cache-fwd.hpp>
+
+#include <bsoncxx/stdx/string_view.hpp>
+
+#include <mongocxx/events/heartbeat_succeeded_event.hpp>
+#include <mongocxx/events/topology_changed_event.hpp>
+#include <mongocxx/events/topology_closed_event.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+///
+/// Keeps a snapshot of the topology of a client or pool, as last described by the driver.
+///
+/// Attach a cache to a client or pool with @ref mongocxx::v_noabi::options::apm::cached_topology.
+/// The driver then passes every topology changed, topology closed, and heartbeat succeeded event
+/// to the cache, which publishes a new snapshot when the topology changes.
+///
+/// Reading the current snapshot neither locks nor allocates, so that it may be done for every
+/// request, e.g. to route or shed requests according to the servers available. A snapshot is
+/// immutable and remains valid while it is held, even if a newer one is published meanwhile.
+/// Snapshots replaced while held are freed when the cache is next updated after their release,
+/// so they should be held only briefly.
+///
+/// The round-trip time of a server is that of the last topology change, refreshed by the
+/// heartbeats which are not awaited. Servers monitored with the streaming protocol therefore keep
+/// the round-trip time of the last topology change.
+///
+/// A cache should observe a single client or pool. All member functions are thread-safe.
+///
+class topology_cache {
+   private:
+    struct state;
+
+   public:
+    ///
+    /// A server of the topology.
+    ///
+    struct server {
+        ///
+        /// An opaque id, unique to this server for the client or pool.
+        ///
+        std::uint32_t id;
+
+        ///
+        /// The host name of the server.
+        ///
+        std::string host;
+
+        ///
+        /// The port of the server.
+        ///
+        std::uint16_t port;
+
+        ///
+        /// The server type: "Unknown", "Standalone", "Mongos", "PossiblePrimary", "RSPrimary",
+        /// "RSSecondary", "RSArbiter", "RSOther", "RSGhost", or "LoadBalancer".
+        ///
+        std::string type;
+
+        ///
+        /// The round-trip time to the server in microseconds, or -1 if unknown.
+        ///
+        std::int64_t round_trip_time;
+
+        ///
+        /// The tags of the server, as reported by its last hello response, in that order.
+        ///
+        std::vector<std::pair<std::string, std::string>> tags;
+    };
+
+    ///
+    /// An immutable snapshot of the topology.
+    ///
+    class snapshot {
+       public:
+        ///
+        /// Move constructs a snapshot.
+        ///
+        MONGOCXX_ABI_EXPORT_CDECL() snapshot(snapshot&& other) noexcept;
+
+        ///
+        /// Move assigns a snapshot.
+        ///
+        MONGOCXX_ABI_EXPORT_CDECL(snapshot&) operator=(snapshot&& other) noexcept;
+
+        snapshot(snapshot const&) = delete;
+        snapshot& operator=(snapshot const&) = delete;
+
+        ///
+        /// Releases the snapshot.
+        ///
+        MONGOCXX_ABI_EXPORT_CDECL() ~snapshot();
+
+        ///
+        /// The number of snapshots published by the cache up to this one, or 0 if no snapshot was
+        /// published yet.
+        ///
+        MONGOCXX_ABI_EXPORT_CDECL(std::uint64_t) version() const noexcept;
+
+        ///
+        /// The topology type: "Unknown", "Sharded", "ReplicaSetNoPrimary", "ReplicaSetWithPrimary",
+        /// "Single", or "LoadBalanced".
+        ///
+        MONGOCXX_ABI_EXPORT_CDECL(std::string const&) type() const noexcept;
+
+        ///
+        /// Whether a primary, mongos, or standalone is known.
+        ///
+        MONGOCXX_ABI_EXPORT_CDECL(bool) has_writable_server() const noexcept;
+
+        ///
+        /// The servers of the topology, ordered by host and port.
+        ///
+        MONGOCXX_ABI_EXPORT_CDECL(std::vector<server> const&) servers() const noexcept;
+
+        ///
+        /// Finds a server of the topology.
+        ///
+        /// @return The server, or a null pointer if the topology has no such server. The pointer
+        ///   is valid as long as this snapshot.
+        ///
+        MONGOCXX_ABI_EXPORT_CDECL(server const*)
+        find(bsoncxx::v_noabi::stdx::string_view host, std::uint16_t port) const noexcept;
+
+       private:
+        friend ::mongocxx::v_noabi::topology_cache;
+
+        explicit snapshot(state const* s) noexcept;
+
+        state const* _state;
+    };
+
+    ///
+    /// Constructs a cache of an unknown topology without servers.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() topology_cache();
+
+    MONGOCXX_ABI_EXPORT_CDECL() ~topology_cache();
+
+    topology_cache(topology_cache&&) = delete;
+    topology_cache& operator=(topology_cache&&) = delete;
+
+    topology_cache(topology_cache const&) = delete;
+    topology_cache& operator=(topology_cache const&) = delete;
+
+    ///
+    /// Returns the current snapshot. Neither locks nor allocates.
+    ///
+    /// The snapshot must not outlive the cache.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(snapshot) current() const noexcept;
+
+    ///
+    /// Publishes a snapshot of the new description of the topology.
+    ///
+    /// This is called by the driver for every topology changed event of a client configured with
+    /// this cache.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) update(events::topology_changed_event const& event) noexcept;
+
+    ///
+    /// Publishes a snapshot of an unknown topology without servers.
+    ///
+    /// This is called by the driver for every topology closed event of a client configured with
+    /// this cache.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) update(events::topology_closed_event const& event) noexcept;
+
+    ///
+    /// Folds the duration of a heartbeat which is not awaited into the round-trip time of its
+    /// server, publishing a snapshot if the server is known. Ignored otherwise.
+    ///
+    /// This is called by the driver for every heartbeat succeeded event of a client configured
+    /// with this cache.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) update(events::heartbeat_succeeded_event const& event) noexcept;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::topology_cache.
+///
@@ -0,0 +1,70 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/tracing/exporter-fwd.hpp>
+
+#include <mongocxx/tracing/span.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace tracing {
+
+///
+/// The interface which user-defined span exporters must implement.
+///
+/// @see
+/// - @ref mongocxx::v_noabi::tracing::tracer
+///
+class exporter {
+   public:
+    virtual ~exporter();
+
+    exporter(exporter&&) = default;
+    exporter& operator=(exporter&&) = default;
+    exporter(exporter const&) = default;
+    exporter& operator=(exporter const&) = default;
+
+    ///
+    /// Handles a completed span.
+    ///
+    /// This is called by the thread which ran the command, once the command has succeeded or
+    /// failed, and may be called by several threads concurrently. Implementations which perform
+    /// slow I/O should hand the span off to another thread.
+    ///
+    /// @param s
+    ///   The span. Only valid for the duration of the call.
+    ///
+    virtual void operator()(span const& s) noexcept = 0;
+
+   protected:
+    ///
+    /// Default constructor
+    ///
+    exporter();
+};
+
+} // namespace tracing
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::tracing::exporter.
+///
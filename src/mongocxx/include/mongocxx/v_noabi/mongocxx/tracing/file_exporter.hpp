@@ -0,0 +1,85 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <mongocxx/tracing/file_exporter-fwd.hpp>
+
+#include <bsoncxx/string/view_or_value.hpp>
+
+#include <mongocxx/tracing/exporter.hpp>
+#include <mongocxx/tracing/span.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace tracing {
+
+///
+/// A span exporter which appends each span to a file as a line of relaxed extended JSON.
+///
+/// Each line is a document with the fields of mongocxx::v_noabi::tracing::span, where `start_time`
+/// is a date and `duration_us` is the duration in microseconds. Fields which are empty or unset are
+/// omitted.
+///
+/// All member functions are thread-safe.
+///
+class file_exporter final : public exporter {
+   public:
+    ///
+    /// Opens a file for appending.
+    ///
+    /// @param path
+    ///   The path of the file, which is created if it does not exist.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::logic_error if the file cannot be opened.
+    ///
+    explicit file_exporter(bsoncxx::v_noabi::string::view_or_value path);
+
+    ///
+    /// Flushes and closes the file.
+    ///
+    ~file_exporter() override;
+
+    file_exporter(file_exporter&&) = delete;
+    file_exporter& operator=(file_exporter&&) = delete;
+    file_exporter(file_exporter const&) = delete;
+    file_exporter& operator=(file_exporter const&) = delete;
+
+    void operator()(span const& s) noexcept override;
+
+    ///
+    /// Flushes the spans written so far to the file.
+    ///
+    void flush();
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace tracing
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::tracing::file_exporter.
+///
@@ -0,0 +1,81 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <mongocxx/tracing/memory_exporter-fwd.hpp>
+
+#include <mongocxx/tracing/exporter.hpp>
+#include <mongocxx/tracing/span.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace tracing {
+
+///
+/// A span exporter which keeps the most recent spans in memory, e.g. for tests.
+///
+/// All member functions are thread-safe.
+///
+class memory_exporter final : public exporter {
+   public:
+    ///
+    /// Constructs an exporter which keeps up to `capacity` spans. Once full, the oldest span is
+    /// discarded for each new span.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::logic_error if the capacity is 0.
+    ///
+    explicit memory_exporter(std::size_t capacity = 1024);
+
+    ~memory_exporter() override;
+
+    memory_exporter(memory_exporter&&) = delete;
+    memory_exporter& operator=(memory_exporter&&) = delete;
+    memory_exporter(memory_exporter const&) = delete;
+    memory_exporter& operator=(memory_exporter const&) = delete;
+
+    void operator()(span const& s) noexcept override;
+
+    ///
+    /// Returns a copy of the kept spans, oldest first.
+    ///
+    std::vector<span> spans() const;
+
+    ///
+    /// Discards the kept spans.
+    ///
+    void clear() noexcept;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace tracing
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::tracing::memory_exporter.
+///
@@ -0,0 +1,117 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <mongocxx/tracing/span-fwd.hpp>
+
+#include <bsoncxx/oid.hpp>
+#include <bsoncxx/stdx/optional.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace tracing {
+
+///
+/// A command sent to a server, from its started event to its succeeded or failed event.
+///
+/// The commands sent on behalf of a single operation share the same @ref operation_id, which
+/// identifies the parent operation of the span. A command which is retried produces one span per
+/// attempt.
+///
+struct span {
+    ///
+    /// The name of the command, e.g. `find`.
+    ///
+    std::string command_name;
+
+    ///
+    /// The name of the database the command was run on.
+    ///
+    std::string database_name;
+
+    ///
+    /// The name of the collection the command applies to, or empty if the command does not apply
+    /// to a collection.
+    ///
+    std::string collection_name;
+
+    ///
+    /// The host name of the server.
+    ///
+    std::string host;
+
+    ///
+    /// The port of the server.
+    ///
+    std::uint16_t port;
+
+    ///
+    /// The service ID of the server, if any.
+    ///
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::oid> service_id;
+
+    ///
+    /// The request ID of the command, unique to the span.
+    ///
+    std::int64_t request_id;
+
+    ///
+    /// The operation ID of the command, shared by the spans of an operation.
+    ///
+    std::int64_t operation_id;
+
+    ///
+    /// 1 for the first attempt of the command, or a greater number if the command is a retry of a
+    /// failed command of the same operation.
+    ///
+    std::uint32_t attempt;
+
+    ///
+    /// The time at which the command was started.
+    ///
+    std::chrono::system_clock::time_point start_time;
+
+    ///
+    /// The duration of the command as measured by the driver.
+    ///
+    std::chrono::microseconds duration;
+
+    ///
+    /// Whether the command failed.
+    ///
+    bool failed;
+
+    ///
+    /// The `errmsg` of the failure reply, if any.
+    ///
+    std::string error_message;
+};
+
+} // namespace tracing
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::tracing::span.
+///
@@ -0,0 +1,103 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <mongocxx/tracing/tracer-fwd.hpp>
+
+#include <mongocxx/events/command_failed_event.hpp>
+#include <mongocxx/events/command_started_event.hpp>
+#include <mongocxx/events/command_succeeded_event.hpp>
+#include <mongocxx/tracing/exporter.hpp>
+
+#include <mongocxx/config/prelude.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace tracing {
+
+///
+/// Pairs command monitoring events into spans and passes them to an exporter.
+///
+/// Attach a tracer to a client or pool with @ref mongocxx::v_noabi::options::apm::tracer. For each
+/// command, the tracer records the started event, pairs it with the succeeded or failed event of
+/// the same request, and passes the resulting mongocxx::v_noabi::tracing::span to the exporter.
+///
+/// The events of a command are published by the thread running the command with no other command
+/// in between, so the pending span is kept per thread and pairing takes no lock.
+///
+/// All member functions are thread-safe.
+///
+class tracer {
+   public:
+    ///
+    /// Constructs a tracer which passes completed spans to an exporter.
+    ///
+    /// @exception
+    ///   Throws mongocxx::v_noabi::logic_error if the exporter is null.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() explicit tracer(std::shared_ptr<tracing::exporter> exporter);
+
+    MONGOCXX_ABI_EXPORT_CDECL() ~tracer();
+
+    tracer(tracer&&) = delete;
+    tracer& operator=(tracer&&) = delete;
+
+    tracer(tracer const&) = delete;
+    tracer& operator=(tracer const&) = delete;
+
+    ///
+    /// Starts the span of a command.
+    ///
+    /// This is called by the driver for every command started event of a client configured with
+    /// this tracer.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) start(events::command_started_event const& event) noexcept;
+
+    ///
+    /// Completes the span of a command started by the same thread and passes it to the exporter.
+    /// Ignored if no span was started for the command.
+    ///
+    /// This is called by the driver for every command succeeded or failed event of a client
+    /// configured with this tracer.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) finish(events::command_succeeded_event const& event) noexcept;
+
+    ///
+    /// @copydoc finish(events::command_succeeded_event const& event)
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) finish(events::command_failed_event const& event) noexcept;
+
+    ///
+    /// Returns the exporter.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::shared_ptr<tracing::exporter> const&) exporter() const noexcept;
+
+   private:
+    class impl;
+    std::unique_ptr<impl> _impl;
+};
+
+} // namespace tracing
+} // namespace v_noabi
+} // namespace mongocxx
+
+#include <mongocxx/config/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v_noabi::tracing::tracer.
+///
@@ -0,0 +1,271 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+// A bounded multi-producer single-consumer ring buffer drained by a background thread. Each cell
+// carries a sequence number which tells producers and the consumer whether the cell is free or
+// holds a value for the current lap. Producers claim a position with a compare-and-swap, fill the
+// value of the cell in place, and publish it by advancing the sequence number of the cell. Values
+// are never moved out of their cell, so the memory they own is reused by later laps.
+template <typename T>
+class background_queue {
+   public:
+    // Invoked on the background thread. Must not throw.
+    using consumer = std::function<void(T&)>;
+
+    // Throws mongocxx::v_noabi::logic_error if the capacity is 0 or greater than 2^30. The
+    // capacity is rounded up to a power of two.
+    background_queue(std::size_t capacity, consumer fn)
+        : _consumer{std::move(fn)},
+          _mask{round_up_capacity(capacity) - 1u},
+          _cells{new cell[_mask + 1u]},
+          _enqueue_pos{0},
+          _posted{0},
+          _dropped{0},
+          _sleeping{false},
+          _flushing{0},
+          _stop{false},
+          _dequeue_pos{0},
+          _delivered{0},
+          _processed{0} {
+        for (std::size_t i = 0; i <= _mask; ++i) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        _thread = std::thread{[this] { this->run(); }};
+    }
+
+    // Delivers the values already posted, then stops the background thread.
+    ~background_queue() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stop = true;
+        }
+
+        _wake.notify_one();
+        _thread.join();
+    }
+
+    background_queue(background_queue&&) = delete;
+    background_queue& operator=(background_queue&&) = delete;
+
+    background_queue(background_queue const&) = delete;
+    background_queue& operator=(background_queue const&) = delete;
+
+    // Fills a free cell with `fill(T&)` and publishes it. Returns false and counts the value as
+    // dropped if the buffer is full or if `fill` throws.
+    template <typename Fill>
+    bool post(Fill fill) noexcept {
+        std::uint64_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+        cell* c;
+
+        for (;;) {
+            c = &_cells[pos & _mask];
+
+            std::uint64_t const sequence = c->sequence.load(std::memory_order_acquire);
+
+            if (sequence == pos) {
+                if (_enqueue_pos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (sequence < pos) {
+                // The cell still holds the value of the previous lap: the buffer is full.
+                _dropped.fetch_add(1u, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = _enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        bool valid = true;
+
+        try {
+            fill(c->value);
+        } catch (...) {
+            // The cell must be published regardless so the consumer does not stall on it.
+            valid = false;
+        }
+
+        (valid ? _posted : _dropped).fetch_add(1u, std::memory_order_relaxed);
+
+        c->valid = valid;
+
+        c->sequence.store(pos + 1u, std::memory_order_release);
+
+        // Pairs with the fence in run(): either the consumer observes the value before sleeping, or
+        // this thread observes that the consumer is sleeping.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (_sleeping.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _wake.notify_one();
+        }
+
+        return valid;
+    }
+
+    // Blocks until every value posted before the call has been delivered or discarded.
+    void flush() {
+        std::uint64_t const target = _enqueue_pos.load(std::memory_order_relaxed);
+
+        _flushing.fetch_add(1u, std::memory_order_seq_cst);
+
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _drained.wait(lock, [&] { return _processed.load(std::memory_order_seq_cst) >= target; });
+        }
+
+        _flushing.fetch_sub(1u, std::memory_order_relaxed);
+    }
+
+    std::size_t capacity() const noexcept {
+        return _mask + 1u;
+    }
+
+    // The number of values filled and published. Values which failed to fill are only counted as
+    // dropped.
+    std::uint64_t posted() const noexcept {
+        return _posted.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t delivered() const noexcept {
+        return _delivered.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t dropped() const noexcept {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+   private:
+    struct cell {
+        std::atomic<std::uint64_t> sequence;
+        bool valid = false;
+        T value = {};
+    };
+
+    static std::size_t round_up_capacity(std::size_t capacity) {
+        if (capacity == 0u || capacity > (std::size_t{1} << 30)) {
+            throw logic_error{error_code::k_invalid_parameter};
+        }
+
+        std::size_t ret = 1u;
+
+        while (ret < capacity) {
+            ret <<= 1u;
+        }
+
+        return ret;
+    }
+
+    bool ready() const noexcept {
+        return _cells[_dequeue_pos & _mask].sequence.load(std::memory_order_acquire) == _dequeue_pos + 1u;
+    }
+
+    bool deliver_one() noexcept {
+        if (!ready()) {
+            return false;
+        }
+
+        cell& c = _cells[_dequeue_pos & _mask];
+
+        if (c.valid) {
+            // Delivered in place: the value is reused by a later lap instead of being moved out.
+            _consumer(c.value);
+            _delivered.fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        c.sequence.store(_dequeue_pos + _mask + 1u, std::memory_order_release);
+        ++_dequeue_pos;
+        _processed.store(_dequeue_pos, std::memory_order_seq_cst);
+
+        if (_flushing.load(std::memory_order_seq_cst) != 0u) {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _drained.notify_all();
+        }
+
+        return true;
+    }
+
+    void run() noexcept {
+        for (;;) {
+            while (deliver_one()) {
+            }
+
+            std::unique_lock<std::mutex> lock{_mutex};
+
+            _drained.notify_all();
+
+            if (_stop) {
+                lock.unlock();
+
+                while (deliver_one()) {
+                }
+
+                return;
+            }
+
+            _sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            _wake.wait(lock, [&] { return _stop || ready(); });
+
+            _sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    consumer const _consumer;
+    std::size_t const _mask;
+    std::unique_ptr<cell[]> const _cells;
+
+    // Written by producers.
+    std::atomic<std::uint64_t> _enqueue_pos;
+    std::atomic<std::uint64_t> _posted;
+    std::atomic<std::uint64_t> _dropped;
+    std::atomic<bool> _sleeping;
+    std::atomic<std::size_t> _flushing;
+
+    // Only used to sleep and wake up. Placed between the producer and consumer fields so that they
+    // do not share a cache line.
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _drained;
+    bool _stop;
+
+    // Written by the consumer.
+    std::uint64_t _dequeue_pos;
+    std::atomic<std::uint64_t> _delivered;
+    std::atomic<std::uint64_t> _processed;
+
+    std::thread _thread;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
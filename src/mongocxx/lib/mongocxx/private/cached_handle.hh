@@ -0,0 +1,32 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+// A database or collection handle cached by a client is shared by every caller of the client, so
+// changing its concerns, renaming it, or assigning to it would change it for all of them.
+inline void check_not_cached(bool cached) {
+    if (cached) {
+        throw logic_error{error_code::k_invalid_parameter, "cannot modify a cached handle; copy it first"};
+    }
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
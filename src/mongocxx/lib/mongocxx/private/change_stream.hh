@@ -14,6 +14,13 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/document/value.hpp>
 #include <bsoncxx/document/view.hpp>
 #include <bsoncxx/stdx/optional.hpp>
 
@@ -21,6 +28,7 @@
 #include <mongocxx/exception/query_exception.hpp>
 
 #include <mongocxx/private/bson.hh>
+#include <mongocxx/private/change_stream_batch.hh>
 #include <mongocxx/private/mongoc.hh>
 #include <mongocxx/private/mongoc_error.hh>
 
@@ -36,7 +44,7 @@ class change_stream::impl {
     enum class state { k_pending, k_started, k_dead };
 
     explicit impl(mongoc_change_stream_t* change_stream)
-        : change_stream_(change_stream), status_{state::k_pending}, exhausted_{true} {}
+        : change_stream_(change_stream), status_{state::k_pending}, exhausted_{true}, pending_error_{} {}
 
     // no copy or move
     impl(impl&) = delete;
@@ -60,6 +68,13 @@ class change_stream::impl {
         return exhausted_;
     }
 
+    // Whether no further event can be read: an invalidate event was read, or the server closed the
+    // cursor and every event of its last batch was read. libmongoc then returns no event without
+    // issuing a getMore.
+    bool has_ended() const {
+        return invalidated_ || (batch_.closed() && batch_.drained());
+    }
+
     void mark_dead() {
         mark_nothing_left();
         status_ = state::k_dead;
@@ -77,10 +92,14 @@ class change_stream::impl {
     }
 
     void advance_iterator() {
+        this->throw_pending_error();
+
+        change_stream_batch::scope scope{this->batch_};
         bson_t const* out;
 
         // Happy-case.
         if (libmongoc::change_stream_next(this->change_stream_, &out)) {
+            this->batch_.consumed();
             this->doc_ = bsoncxx::v_noabi::document::view{bson_get_data(out), out->len};
             return;
         }
@@ -99,6 +118,87 @@ class change_stream::impl {
         this->mark_nothing_left();
     }
 
+    // Passes each event to `sink(std::uint8_t const* data, std::uint32_t length)`, stopping at the
+    // end of the current server batch, when nothing is left, or after `max_events` events (0 for no
+    // limit). The event is only valid for the duration of the call.
+    //
+    // An error after some events were read is reported by the next read instead, so that the
+    // events are returned with their resume token.
+    template <typename Sink>
+    void read_events(std::size_t max_events, Sink sink) {
+        this->throw_pending_error();
+
+        // Any event currently referenced by an iterator is considered consumed.
+        this->mark_nothing_left();
+
+        change_stream_batch::scope scope{this->batch_};
+        bson_t const* out;
+        std::size_t count = 0u;
+
+        while (max_events == 0 || count < max_events) {
+            // Reading past the end of the batch would issue a getMore, which may wait for the
+            // max_await_time before returning the events of the next batch.
+            if (count > 0u && this->batch_.drained()) {
+                break;
+            }
+
+            if (!libmongoc::change_stream_next(this->change_stream_, &out)) {
+                bson_error_t error;
+                if (libmongoc::change_stream_error_document(this->change_stream_, &error, &out)) {
+                    mongocxx::libbson::scoped_bson_t scoped_error_reply{};
+                    bson_copy_to(out, scoped_error_reply.bson_for_init());
+
+                    if (count == 0u) {
+                        this->mark_dead();
+                        throw_exception<query_exception>(scoped_error_reply.steal(), error);
+                    }
+
+                    this->pending_error_reply_ = scoped_error_reply.steal();
+                    this->pending_error_ = error;
+                }
+                break;
+            }
+
+            this->batch_.consumed();
+            ++count;
+
+            sink(bson_get_data(out), out->len);
+
+            // The server closes the cursor after an invalidate event.
+            bson_iter_t iter;
+            if (bson_iter_init_find(&iter, out, "operationType") && BSON_ITER_HOLDS_UTF8(&iter) &&
+                std::strcmp(bson_iter_utf8(&iter, nullptr), "invalidate") == 0) {
+                this->invalidated_ = true;
+                break;
+            }
+        }
+    }
+
+    // Reads events into `data` (concatenated) and records their starting offsets in `offsets`, as
+    // read_events() does. The resume token observed afterwards is copied into `token`.
+    void read_batch(
+        std::vector<std::uint8_t>& data,
+        std::vector<std::size_t>& offsets,
+        std::vector<std::uint8_t>& token,
+        std::size_t max_events) {
+        this->read_events(max_events, [&](std::uint8_t const* bytes, std::uint32_t length) {
+            offsets.push_back(data.size());
+            data.insert(data.end(), bytes, bytes + length);
+        });
+
+        token.clear();
+        if (bson_t const* const resume_token = libmongoc::change_stream_get_resume_token(this->change_stream_)) {
+            std::uint8_t const* const bytes = bson_get_data(resume_token);
+            token.assign(bytes, bytes + resume_token->len);
+        }
+    }
+
+    // The batch returned by the aggregate opening the stream is observed before the stream is
+    // constructed.
+    change_stream_batch& batch() {
+        return this->batch_;
+    }
+
     bsoncxx::v_noabi::document::view& doc() {
         return this->doc_;
     }
@@ -114,10 +214,25 @@ class change_stream::impl {
     }
 
    private:
+    void throw_pending_error() {
+        if (!this->pending_error_reply_) {
+            return;
+        }
+
+        bsoncxx::v_noabi::document::value reply = std::move(*this->pending_error_reply_);
+        this->pending_error_reply_.reset();
+        this->mark_dead();
+        throw_exception<query_exception>(std::move(reply), this->pending_error_);
+    }
+
     mongoc_change_stream_t* const change_stream_;
     bsoncxx::v_noabi::document::view doc_;
     state status_;
     bool exhausted_;
+    bool invalidated_ = false;
+    change_stream_batch batch_;
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value> pending_error_reply_;
+    bson_error_t pending_error_;
 };
 
 } // namespace v_noabi
@@ -0,0 +1,123 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include <mongocxx/private/mongoc.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+
+// The number of events of the current server batch of a change stream not yet returned by libmongoc.
+//
+// libmongoc does not expose the batch state of the cursor of a change stream. The size of each batch
+// is therefore taken from the aggregate or getMore reply, which command monitoring reports on the
+// thread calling into libmongoc while a scope is active.
+class change_stream_batch {
+   public:
+    class scope {
+       public:
+        explicit scope(change_stream_batch& batch) noexcept : _previous{current()} {
+            current() = &batch;
+        }
+
+        ~scope() {
+            current() = _previous;
+        }
+
+        scope(scope&&) = delete;
+        scope& operator=(scope&&) = delete;
+
+        scope(scope const&) = delete;
+        scope& operator=(scope const&) = delete;
+
+       private:
+        change_stream_batch* _previous;
+    };
+
+    // Whether every event of the current batch is known to have been returned.
+    bool drained() const noexcept {
+        return _known && _remaining == 0u;
+    }
+
+    // Whether the server closed the cursor of the change stream with the current batch, e.g. after
+    // an invalidate event.
+    bool closed() const noexcept {
+        return _closed;
+    }
+
+    // Called for every event returned by libmongoc.
+    void consumed() noexcept {
+        if (_remaining > 0u) {
+            --_remaining;
+        }
+    }
+
+    // Called for every command succeeded event.
+    static void observe(char const* command_name, bson_t const* reply) noexcept {
+        change_stream_batch* const batch = current();
+
+        if (!batch) {
+            return;
+        }
+
+        char const* path;
+
+        if (std::strcmp(command_name, "aggregate") == 0) {
+            path = "cursor.firstBatch";
+        } else if (std::strcmp(command_name, "getMore") == 0) {
+            path = "cursor.nextBatch";
+        } else {
+            return;
+        }
+
+        bson_iter_t iter;
+        bson_iter_t events;
+
+        if (!bson_iter_init(&iter, reply) || !bson_iter_find_descendant(&iter, path, &events) ||
+            !BSON_ITER_HOLDS_ARRAY(&events) || !bson_iter_recurse(&events, &iter)) {
+            batch->_known = false;
+            return;
+        }
+
+        std::size_t count = 0u;
+
+        while (bson_iter_next(&iter)) {
+            ++count;
+        }
+
+        bson_iter_t id;
+
+        batch->_known = true;
+        batch->_remaining = count;
+        batch->_closed = bson_iter_init(&iter, reply) && bson_iter_find_descendant(&iter, "cursor.id", &id) &&
+                         BSON_ITER_HOLDS_INT64(&id) && bson_iter_int64(&id) == 0;
+    }
+
+   private:
+    static change_stream_batch*& current() noexcept {
+        static thread_local change_stream_batch* batch = nullptr;
+        return batch;
+    }
+
+    bool _known = false;
+    bool _closed = false;
+    std::size_t _remaining = 0u;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
@@ -18,6 +18,7 @@
 
 #include <mongocxx/client.hpp>
 
+#include <mongocxx/private/handle_cache.hh>
 #include <mongocxx/private/mongoc.hh>
 #include <mongocxx/private/write_concern.hh>
 
@@ -29,6 +30,9 @@ class client::impl {
     impl(mongoc_client_t* client) : client_t(client) {}
 
     ~impl() {
+        // The cached handles are destroyed before the client they refer to. A pooled client clears
+        // them before its mongoc_client_t is pushed back to the pool, which leaves it null here.
+        handles.clear();
         libmongoc::client_destroy(client_t);
     }
 
@@ -41,6 +45,7 @@ class client::impl {
     mongoc_client_t* client_t;
     std::list<bsoncxx::v_noabi::string::view_or_value> tls_options;
     options::apm listeners;
+    handle_cache handles;
 };
 
 } // namespace v_noabi
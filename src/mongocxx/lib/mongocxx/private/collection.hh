@@ -36,12 +36,13 @@ class collection::impl {
         mongoc_collection_t* collection,
         bsoncxx::v_noabi::stdx::string_view database_name,
         mongocxx::v_noabi::client::impl const* client)
-        : collection_t(collection), database_name(std::move(database_name)), client_impl(client) {}
+        : collection_t(collection), database_name(std::move(database_name)), client_impl(client), cached(false) {}
 
     impl(impl const& i)
         : collection_t{libmongoc::collection_copy(i.collection_t)},
           database_name{i.database_name},
-          client_impl{i.client_impl} {}
+          client_impl{i.client_impl},
+          cached{false} {}
 
     impl& operator=(impl const& i) {
         if (this != &i) {
@@ -62,6 +63,9 @@ class collection::impl {
     mongoc_collection_t* collection_t;
     std::string database_name;
     mongocxx::v_noabi::client::impl const* client_impl;
+
+    // Whether the handle is cached by its client, which shares it between callers. Not copied.
+    bool cached;
 };
 
 } // namespace v_noabi
@@ -0,0 +1,52 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <bsoncxx/document/element.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/stdx/string_view.hpp>
+#include <bsoncxx/types.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+// Returns the name of the collection a command applies to, or an empty string.
+//
+// Most commands name their collection in their first field, e.g. `{find: "coll"}`. `getMore` names
+// its cursor ID there and its collection in the `collection` field.
+inline bsoncxx::v_noabi::stdx::string_view command_collection_name(
+    bsoncxx::v_noabi::stdx::string_view command_name,
+    bsoncxx::v_noabi::document::view command) {
+    bsoncxx::v_noabi::document::element element;
+
+    if (command_name == "getMore") {
+        element = command["collection"];
+    } else {
+        auto first = command.begin();
+
+        if (first != command.end()) {
+            element = *first;
+        }
+    }
+
+    if (element && element.type() == bsoncxx::v_noabi::type::k_string) {
+        return element.get_string().value;
+    }
+
+    return {};
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
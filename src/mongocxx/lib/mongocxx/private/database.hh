@@ -27,10 +27,10 @@ namespace v_noabi {
 class database::impl {
    public:
     impl(mongoc_database_t* db, mongocxx::v_noabi::client::impl const* client, std::string name)
-        : database_t(db), client_impl(client), name(std::move(name)) {}
+        : database_t(db), client_impl(client), name(std::move(name)), cached(false) {}
 
     impl(impl const& i)
-        : database_t{libmongoc::database_copy(i.database_t)}, client_impl{i.client_impl}, name{i.name} {}
+        : database_t{libmongoc::database_copy(i.database_t)}, client_impl{i.client_impl}, name{i.name}, cached{false} {}
 
     impl& operator=(impl const& i) {
         if (this != &i) {
@@ -50,6 +50,9 @@ class database::impl {
     mongoc_database_t* database_t;
     mongocxx::v_noabi::client::impl const* client_impl;
     std::string name;
+
+    // Whether the handle is cached by its client, which shares it between callers. Not copied.
+    bool cached;
 };
 
 } // namespace v_noabi
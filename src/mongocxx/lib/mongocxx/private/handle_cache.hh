@@ -0,0 +1,143 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/stdx/string_view.hpp>
+
+#include <mongocxx/client.hpp>
+#include <mongocxx/collection.hpp>
+#include <mongocxx/database.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+// The database and collection handles cached by a client. Entries are kept sorted by name and
+// generation so that a lookup is a binary search over string views which does not allocate. Handles
+// are owned through unique pointers so that references to them remain valid as the tables grow.
+//
+// Handles inherit the concerns of the client when they are created. Changing the concerns of the
+// client starts a new generation of handles instead of freeing the previous ones, which may still be
+// referenced. Every handle is freed by clear() or with the client.
+class handle_cache {
+   public:
+    mongocxx::v_noabi::database& database(client const& client, bsoncxx::v_noabi::stdx::string_view name) {
+        database_key const key{name, _generation};
+        auto const it = std::lower_bound(_databases.begin(), _databases.end(), key, database_before);
+
+        if (it != _databases.end() && is(*it, key)) {
+            return *it->handle;
+        }
+
+        std::string owned{name.data(), name.size()};
+        std::unique_ptr<mongocxx::v_noabi::database> handle{new mongocxx::v_noabi::database{client.database(owned)}};
+
+        return *_databases.insert(it, database_entry{std::move(owned), _generation, std::move(handle)})->handle;
+    }
+
+    mongocxx::v_noabi::collection& collection(
+        client const& client,
+        bsoncxx::v_noabi::stdx::string_view database_name,
+        bsoncxx::v_noabi::stdx::string_view name) {
+        collection_key const key{database_name, name, _generation};
+        auto const it = std::lower_bound(_collections.begin(), _collections.end(), key, collection_before);
+
+        if (it != _collections.end() && is(*it, key)) {
+            return *it->handle;
+        }
+
+        std::string owned{name.data(), name.size()};
+        std::unique_ptr<mongocxx::v_noabi::collection> handle{
+            new mongocxx::v_noabi::collection{database(client, database_name).collection(owned)}};
+
+        collection_entry entry{
+            std::string{database_name.data(), database_name.size()}, std::move(owned), _generation, std::move(handle)};
+
+        return *_collections.insert(it, std::move(entry))->handle;
+    }
+
+    void concerns_changed() noexcept {
+        ++_generation;
+    }
+
+    void clear() noexcept {
+        _collections.clear();
+        _databases.clear();
+    }
+
+   private:
+    struct database_entry {
+        std::string name;
+        std::size_t generation;
+        std::unique_ptr<mongocxx::v_noabi::database> handle;
+    };
+
+    struct collection_entry {
+        std::string database_name;
+        std::string name;
+        std::size_t generation;
+        std::unique_ptr<mongocxx::v_noabi::collection> handle;
+    };
+
+    struct database_key {
+        bsoncxx::v_noabi::stdx::string_view name;
+        std::size_t generation;
+    };
+
+    struct collection_key {
+        bsoncxx::v_noabi::stdx::string_view database_name;
+        bsoncxx::v_noabi::stdx::string_view name;
+        std::size_t generation;
+    };
+
+    static bool database_before(database_entry const& entry, database_key const& key) {
+        int const cmp = bsoncxx::v_noabi::stdx::string_view{entry.name}.compare(key.name);
+
+        return cmp < 0 || (cmp == 0 && entry.generation < key.generation);
+    }
+
+    static bool collection_before(collection_entry const& entry, collection_key const& key) {
+        int cmp = bsoncxx::v_noabi::stdx::string_view{entry.database_name}.compare(key.database_name);
+
+        if (cmp == 0) {
+            cmp = bsoncxx::v_noabi::stdx::string_view{entry.name}.compare(key.name);
+        }
+
+        return cmp < 0 || (cmp == 0 && entry.generation < key.generation);
+    }
+
+    static bool is(database_entry const& entry, database_key const& key) {
+        return entry.generation == key.generation && bsoncxx::v_noabi::stdx::string_view{entry.name} == key.name;
+    }
+
+    static bool is(collection_entry const& entry, collection_key const& key) {
+        return entry.generation == key.generation &&
+               bsoncxx::v_noabi::stdx::string_view{entry.database_name} == key.database_name &&
+               bsoncxx::v_noabi::stdx::string_view{entry.name} == key.name;
+    }
+
+    std::size_t _generation = 0u;
+    std::vector<database_entry> _databases;
+    std::vector<collection_entry> _collections;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
@@ -0,0 +1,120 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace mongocxx {
+namespace v_noabi {
+
+// The time recorded by a mongocxx::v_noabi::operation_timer.
+class operation_timing {
+   public:
+    using clock = std::chrono::steady_clock;
+
+    enum phase : std::size_t {
+        k_none,      // Outside of any driver operation.
+        k_prepare,   // Building commands and options in C++.
+        k_libmongoc, // Calling into libmongoc, including the time the server takes.
+        k_results,   // Handling replies and results in C++.
+        k_phase_count,
+    };
+
+    // The timing of the calling thread, or null if no timer exists on the thread.
+    static operation_timing*& current() noexcept {
+        thread_local operation_timing* timing = nullptr;
+        return timing;
+    }
+
+    operation_timing() noexcept {
+        reset();
+    }
+
+    void reset() noexcept {
+        for (auto& total : totals) {
+            total = clock::duration::zero();
+        }
+
+        server = std::chrono::microseconds::zero();
+        commands = 0u;
+        active = k_none;
+        since = clock::now();
+    }
+
+    // Charges the time since the last switch to the active phase, then activates another phase.
+    // Returns the phase which was active.
+    phase enter(phase next) noexcept {
+        auto const now = clock::now();
+        auto const previous = active;
+
+        totals[previous] += now - since;
+        active = next;
+        since = now;
+
+        return previous;
+    }
+
+    // Records a command duration reported by command monitoring.
+    void record_command(std::int64_t duration_us) noexcept {
+        server += std::chrono::microseconds{duration_us};
+        ++commands;
+    }
+
+    clock::duration totals[k_phase_count];
+    std::chrono::microseconds server;
+    std::uint32_t commands;
+    phase active;
+    clock::time_point since;
+};
+
+// Charges the time spent in its scope to a phase of the operation timer of the calling thread, if
+// any. Scopes may be nested: an inner scope suspends the phase of the outer one.
+class operation_phase {
+   public:
+    explicit operation_phase(operation_timing::phase phase) noexcept
+        : _timing{operation_timing::current()}, _previous{operation_timing::k_none} {
+        if (_timing) {
+            _previous = _timing->enter(phase);
+        }
+    }
+
+    ~operation_phase() {
+        if (_timing) {
+            _timing->enter(_previous);
+        }
+    }
+
+    operation_phase(operation_phase&&) = delete;
+    operation_phase& operator=(operation_phase&&) = delete;
+
+    operation_phase(operation_phase const&) = delete;
+    operation_phase& operator=(operation_phase const&) = delete;
+
+    // Switches the phase of this scope, e.g. around a call into libmongoc.
+    void enter(operation_timing::phase phase) noexcept {
+        if (_timing) {
+            _timing->enter(phase);
+        }
+    }
+
+   private:
+    operation_timing* const _timing;
+    operation_timing::phase _previous;
+};
+
+} // namespace v_noabi
+} // namespace mongocxx
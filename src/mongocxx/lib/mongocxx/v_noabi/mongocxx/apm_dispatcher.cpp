@@ -0,0 +1,183 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/apm_dispatcher.hpp>
+
+//
+
+#include <exception>
+#include <iostream>
+#include <utility>
+
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+#include <mongocxx/private/background_queue.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+
+namespace {
+
+void assign_document(std::vector<std::uint8_t>& out, bsoncxx::v_noabi::document::view view, bool copy) {
+    if (copy) {
+        out.assign(view.data(), view.data() + view.length());
+    } else {
+        out.clear();
+    }
+}
+
+} // namespace
+
+class apm_dispatcher::impl {
+   public:
+    impl(listener fn, std::size_t capacity, bool copy_documents)
+        : _listener{std::move(fn)},
+          _copy_documents{copy_documents},
+          _queue{capacity, [this](record& r) { deliver(r); }} {}
+
+    template <typename Fill>
+    bool post(Fill fill) noexcept {
+        return _queue.post(std::move(fill));
+    }
+
+    bool copy_documents() const noexcept {
+        return _copy_documents;
+    }
+
+    void flush() {
+        _queue.flush();
+    }
+
+    std::size_t capacity() const noexcept {
+        return _queue.capacity();
+    }
+
+    statistics stats() const noexcept {
+        statistics ret;
+
+        ret.posted = _queue.posted();
+        ret.delivered = _queue.delivered();
+        ret.dropped = _queue.dropped();
+
+        return ret;
+    }
+
+   private:
+    // A listener exiting via an exception must not terminate the background thread: report it and
+    // carry on with the next record.
+    void deliver(record const& r) noexcept {
+        try {
+            _listener(r);
+        } catch (std::exception const& e) {
+            std::cerr << "error: apm_dispatcher listener exited via an exception: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "error: apm_dispatcher listener exited via an exception" << std::endl;
+        }
+    }
+
+    listener const _listener;
+    bool const _copy_documents;
+
+    // Declared last so that its background thread is joined before the listener is destroyed.
+    background_queue<record> _queue;
+};
+
+constexpr std::size_t apm_dispatcher::k_default_capacity;
+
+bsoncxx::v_noabi::document::view apm_dispatcher::record::document_view() const noexcept {
+    if (document.empty()) {
+        return {};
+    }
+
+    return {document.data(), document.size()};
+}
+
+apm_dispatcher::apm_dispatcher(listener listener, std::size_t capacity, bool copy_documents) {
+    if (!listener) {
+        throw logic_error{error_code::k_invalid_parameter};
+    }
+
+    _impl = bsoncxx::make_unique<impl>(std::move(listener), capacity, copy_documents);
+}
+
+apm_dispatcher::~apm_dispatcher() = default;
+
+bool apm_dispatcher::post(events::command_started_event const& event) noexcept {
+    bool const copy = _impl->copy_documents();
+
+    return _impl->post([&](record& r) {
+        r.type = kind::k_command_started;
+        r.command_name.assign(event.command_name().data(), event.command_name().size());
+        r.database_name.assign(event.database_name().data(), event.database_name().size());
+        r.host.assign(event.host().data(), event.host().size());
+        r.port = event.port();
+        r.request_id = event.request_id();
+        r.operation_id = event.operation_id();
+        r.duration = 0;
+        r.service_id = event.service_id();
+        assign_document(r.document, event.command(), copy);
+    });
+}
+
+bool apm_dispatcher::post(events::command_succeeded_event const& event) noexcept {
+    bool const copy = _impl->copy_documents();
+
+    return _impl->post([&](record& r) {
+        r.type = kind::k_command_succeeded;
+        r.command_name.assign(event.command_name().data(), event.command_name().size());
+        r.database_name.clear();
+        r.host.assign(event.host().data(), event.host().size());
+        r.port = event.port();
+        r.request_id = event.request_id();
+        r.operation_id = event.operation_id();
+        r.duration = event.duration();
+        r.service_id = event.service_id();
+        assign_document(r.document, event.reply(), copy);
+    });
+}
+
+bool apm_dispatcher::post(events::command_failed_event const& event) noexcept {
+    bool const copy = _impl->copy_documents();
+
+    return _impl->post([&](record& r) {
+        r.type = kind::k_command_failed;
+        r.command_name.assign(event.command_name().data(), event.command_name().size());
+        r.database_name.clear();
+        r.host.assign(event.host().data(), event.host().size());
+        r.port = event.port();
+        r.request_id = event.request_id();
+        r.operation_id = event.operation_id();
+        r.duration = event.duration();
+        r.service_id = event.service_id();
+        assign_document(r.document, event.failure(), copy);
+    });
+}
+
+void apm_dispatcher::flush() {
+    _impl->flush();
+}
+
+std::size_t apm_dispatcher::capacity() const noexcept {
+    return _impl->capacity();
+}
+
+apm_dispatcher::statistics apm_dispatcher::stats() const noexcept {
+    return _impl->stats();
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
@@ -0,0 +1,252 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <mongocxx/buffered_change_stream.hpp>
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+#include <mongocxx/private/change_stream.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+
+class buffered_change_stream::impl {
+   public:
+    using event_type = bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>;
+
+    impl(change_stream&& stream, options::buffered_change_stream const& options)
+        : _stream(std::move(stream)),
+          _capacity(options.capacity().value_or(1024u)),
+          _low_watermark(options.low_watermark().value_or(_capacity / 2u)),
+          _stats() {
+        if (_capacity == 0u || _low_watermark >= _capacity) {
+            throw logic_error{error_code::k_invalid_parameter};
+        }
+
+        _thread = std::thread{[this] { this->run(); }};
+    }
+
+    ~impl() {
+        stop();
+    }
+
+    impl(impl&&) = delete;
+    impl& operator=(impl&&) = delete;
+
+    impl(impl const&) = delete;
+    impl& operator=(impl const&) = delete;
+
+    event_type pop() {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _not_empty.wait(lock, [&] { return !_queue.empty() || !_running; });
+        return take(lock);
+    }
+
+    event_type pop_for(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _not_empty.wait_for(lock, timeout, [&] { return !_queue.empty() || !_running; });
+        return take(lock);
+    }
+
+    event_type try_pop() {
+        std::unique_lock<std::mutex> lock{_mutex};
+        return take(lock);
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stopping = true;
+        }
+
+        _not_full.notify_one();
+
+        if (_thread.joinable()) {
+            _thread.join();
+        }
+    }
+
+    bool stopped() const {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return !_running;
+    }
+
+    std::size_t depth() const {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _queue.size();
+    }
+
+    statistics stats() const {
+        std::lock_guard<std::mutex> lock{_mutex};
+        auto ret = _stats;
+        ret.depth = _queue.size();
+        return ret;
+    }
+
+   private:
+    event_type take(std::unique_lock<std::mutex>& lock) {
+        if (_queue.empty()) {
+            if (_error) {
+                std::rethrow_exception(_error);
+            }
+
+            return {};
+        }
+
+        event_type ret{std::move(_queue.front())};
+        _queue.pop_front();
+        ++_stats.consumed;
+
+        auto const resume = _queue.size() <= _low_watermark;
+
+        lock.unlock();
+
+        if (resume) {
+            _not_full.notify_one();
+        }
+
+        return ret;
+    }
+
+    void run() {
+        std::vector<bsoncxx::v_noabi::document::value> events;
+
+        try {
+            for (;;) {
+                std::size_t room;
+                {
+                    std::unique_lock<std::mutex> lock{_mutex};
+
+                    // Hysteresis: once full, wait for consumers to drain to the low watermark so
+                    // that subsequent reads fetch many notifications at once.
+                    if (_queue.size() >= _capacity) {
+                        ++_stats.full_waits;
+                        _not_full.wait(lock, [&] { return _stopping || _queue.size() <= _low_watermark; });
+                    }
+
+                    if (_stopping) {
+                        break;
+                    }
+
+                    room = _capacity - _queue.size();
+                }
+
+                // Copy each event once, straight from the cursor, outside the lock so consumers are
+                // only blocked while notifications are moved into the queue.
+                events.clear();
+                _stream._impl->read_events(room, [&](std::uint8_t const* data, std::uint32_t length) {
+                    events.emplace_back(bsoncxx::v_noabi::document::view{data, length});
+                });
+
+                if (!events.empty()) {
+                    {
+                        std::lock_guard<std::mutex> lock{_mutex};
+
+                        for (auto& event : events) {
+                            _queue.push_back(std::move(event));
+                        }
+
+                        _stats.received += events.size();
+                        _stats.max_depth = (std::max)(_stats.max_depth, _queue.size());
+                    }
+
+                    _not_empty.notify_all();
+                }
+
+                // Reading an ended stream returns immediately without an event: stop rather than spin.
+                if (_stream._impl->has_ended()) {
+                    break;
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _running = false;
+        }
+
+        // Wake every waiting consumer so they observe the end of the stream.
+        _not_empty.notify_all();
+    }
+
+    change_stream _stream; // Only used by _thread.
+    std::size_t const _capacity;
+    std::size_t const _low_watermark;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+    std::deque<bsoncxx::v_noabi::document::value> _queue; // Guarded by _mutex.
+    statistics _stats;                                     // Guarded by _mutex.
+    std::exception_ptr _error;                             // Guarded by _mutex.
+    bool _running = true;                                  // Guarded by _mutex.
+    bool _stopping = false;                                // Guarded by _mutex.
+
+    std::thread _thread;
+};
+
+buffered_change_stream::buffered_change_stream(change_stream&& stream, options::buffered_change_stream const& options)
+    : _impl(bsoncxx::make_unique<impl>(std::move(stream), options)) {}
+
+buffered_change_stream::~buffered_change_stream() = default;
+
+buffered_change_stream::buffered_change_stream(buffered_change_stream&&) noexcept = default;
+buffered_change_stream& buffered_change_stream::operator=(buffered_change_stream&&) noexcept = default;
+
+bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value> buffered_change_stream::pop() {
+    return _impl->pop();
+}
+
+bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value> buffered_change_stream::pop_for(
+    std::chrono::milliseconds timeout) {
+    return _impl->pop_for(timeout);
+}
+
+bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value> buffered_change_stream::try_pop() {
+    return _impl->try_pop();
+}
+
+void buffered_change_stream::stop() {
+    _impl->stop();
+}
+
+bool buffered_change_stream::stopped() const {
+    return _impl->stopped();
+}
+
+std::size_t buffered_change_stream::depth() const {
+    return _impl->depth();
+}
+
+buffered_change_stream::statistics buffered_change_stream::stats() const {
+    return _impl->stats();
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
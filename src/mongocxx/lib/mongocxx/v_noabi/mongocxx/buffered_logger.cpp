@@ -0,0 +1,156 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/buffered_logger.hpp>
+
+//
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+#include <mongocxx/private/background_queue.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+
+namespace {
+
+// A buffered message. The strings keep their capacity from one lap of the ring to the next, so
+// buffering a message does not allocate once the ring has warmed up.
+struct message {
+    log_level level;
+    std::string domain;
+    std::string text;
+};
+
+} // namespace
+
+class buffered_logger::impl {
+   public:
+    impl(std::unique_ptr<logger> sink, log_level level, std::size_t capacity)
+        : _sink{std::move(sink)},
+          _level{level},
+          _filtered{0},
+          _queue{capacity, [this](message& m) { (*_sink)(m.level, m.domain, m.text); }} {}
+
+    void log(
+        log_level level,
+        bsoncxx::v_noabi::stdx::string_view domain,
+        bsoncxx::v_noabi::stdx::string_view text) noexcept {
+        // Levels are ordered from the most severe to the least severe.
+        if (level > _level.load(std::memory_order_relaxed) || is_ignored(domain)) {
+            _filtered.fetch_add(1u, std::memory_order_relaxed);
+            return;
+        }
+
+        _queue.post([&](message& m) {
+            m.level = level;
+            m.domain.assign(domain.data(), domain.size());
+            m.text.assign(text.data(), std::min(text.size(), k_max_message_size));
+        });
+    }
+
+    void level(log_level level) noexcept {
+        _level.store(level, std::memory_order_relaxed);
+    }
+
+    log_level level() const noexcept {
+        return _level.load(std::memory_order_relaxed);
+    }
+
+    void ignore_domain(bsoncxx::v_noabi::stdx::string_view domain) {
+        _ignored_domains.emplace_back(domain.data(), domain.size());
+    }
+
+    void flush() {
+        _queue.flush();
+    }
+
+    statistics stats() const noexcept {
+        statistics ret;
+
+        ret.written = _queue.delivered();
+        ret.dropped = _queue.dropped();
+        ret.filtered = _filtered.load(std::memory_order_relaxed);
+
+        return ret;
+    }
+
+   private:
+    bool is_ignored(bsoncxx::v_noabi::stdx::string_view domain) const noexcept {
+        return std::any_of(_ignored_domains.begin(), _ignored_domains.end(), [&](std::string const& s) {
+            return domain == s;
+        });
+    }
+
+    std::unique_ptr<logger> const _sink;
+    std::atomic<log_level> _level;
+    std::atomic<std::uint64_t> _filtered;
+    std::vector<std::string> _ignored_domains;
+
+    // Declared last so that its background thread is joined before the sink is destroyed.
+    background_queue<message> _queue;
+};
+
+constexpr std::size_t buffered_logger::k_default_capacity;
+constexpr std::size_t buffered_logger::k_max_message_size;
+
+buffered_logger::buffered_logger(std::unique_ptr<logger> sink, log_level level, std::size_t capacity) {
+    if (!sink) {
+        throw logic_error{error_code::k_invalid_parameter};
+    }
+
+    _impl = bsoncxx::make_unique<impl>(std::move(sink), level, capacity);
+}
+
+buffered_logger::~buffered_logger() = default;
+
+void buffered_logger::operator()(
+    log_level level,
+    bsoncxx::v_noabi::stdx::string_view domain,
+    bsoncxx::v_noabi::stdx::string_view message) noexcept {
+    _impl->log(level, domain, message);
+}
+
+void buffered_logger::level(log_level level) noexcept {
+    _impl->level(level);
+}
+
+log_level buffered_logger::level() const noexcept {
+    return _impl->level();
+}
+
+buffered_logger& buffered_logger::ignore_domain(bsoncxx::v_noabi::string::view_or_value domain) {
+    _impl->ignore_domain(domain.view());
+    return *this;
+}
+
+void buffered_logger::flush() {
+    _impl->flush();
+}
+
+buffered_logger::statistics buffered_logger::stats() const noexcept {
+    return _impl->stats();
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
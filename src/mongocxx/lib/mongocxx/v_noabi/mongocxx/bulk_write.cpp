@@ -28,6 +28,7 @@
 #include <mongocxx/private/collection.hh>
 #include <mongocxx/private/mongoc.hh>
 #include <mongocxx/private/mongoc_error.hh>
+#include <mongocxx/private/operation_timing.hh>
 #include <mongocxx/private/write_concern.hh>
 
 namespace mongocxx {
@@ -46,6 +47,8 @@ bool bulk_write::empty() const noexcept {
 }
 
 bulk_write& bulk_write::append(model::write const& operation) {
+    operation_phase const phase{operation_timing::k_prepare};
+
     switch (operation.type()) {
         case write_type::k_insert_one: {
             scoped_bson_t doc(operation.get_insert_one().document());
@@ -192,10 +195,14 @@ bsoncxx::v_noabi::stdx::optional<result::bulk_write> bulk_write::execute() const
     scoped_bson_t reply;
     bson_error_t error;
 
+    operation_phase phase{operation_timing::k_libmongoc};
+
     if (!libmongoc::bulk_operation_execute(b, reply.bson_for_init(), &error)) {
         throw_exception<bulk_write_exception>(reply.steal(), error);
     }
 
+    phase.enter(operation_timing::k_results);
+
     // Reply is empty for unacknowledged writes, so return disengaged optional.
     if (reply.view().empty()) {
         return bsoncxx::v_noabi::stdx::nullopt;
@@ -208,6 +215,8 @@ bsoncxx::v_noabi::stdx::optional<result::bulk_write> bulk_write::execute() const
 
 bulk_write::bulk_write(collection const& coll, options::bulk_write const& options, client_session const* session)
     : _created_from_collection{true} {
+    operation_phase const phase{operation_timing::k_prepare};
+
     bsoncxx::v_noabi::builder::basic::document options_builder;
     if (!options.ordered()) {
         // ordered is true by default. Only append it if set to false.
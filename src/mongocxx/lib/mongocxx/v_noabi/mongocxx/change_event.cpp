@@ -0,0 +1,116 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/types.hpp>
+
+#include <mongocxx/change_event.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+
+namespace {
+
+using operation_type = change_event::operation_type;
+
+operation_type to_operation_type(bsoncxx::v_noabi::stdx::string_view name) {
+    static constexpr struct {
+        char const* name;
+        operation_type type;
+    } types[] = {
+        {"insert", operation_type::k_insert},
+        {"update", operation_type::k_update},
+        {"replace", operation_type::k_replace},
+        {"delete", operation_type::k_delete},
+        {"drop", operation_type::k_drop},
+        {"rename", operation_type::k_rename},
+        {"dropDatabase", operation_type::k_drop_database},
+        {"invalidate", operation_type::k_invalidate},
+    };
+
+    for (auto const& t : types) {
+        if (name == t.name) {
+            return t.type;
+        }
+    }
+
+    return operation_type::k_other;
+}
+
+bsoncxx::v_noabi::stdx::string_view get_utf8(bsoncxx::v_noabi::document::element const& e) {
+    return e.type() == bsoncxx::v_noabi::type::k_string ? e.get_string().value
+                                                        : bsoncxx::v_noabi::stdx::string_view{};
+}
+
+} // namespace
+
+change_event::change_event(bsoncxx::v_noabi::document::view event) : _event{event} {
+    using bsoncxx::v_noabi::type;
+
+    for (auto const& e : event) {
+        auto const key = e.key();
+        auto const t = e.type();
+
+        if (key == "_id") {
+            if (t == type::k_document) {
+                _resume_token = e.get_document().value;
+            }
+        } else if (key == "operationType") {
+            _operation_name = get_utf8(e);
+            _operation = to_operation_type(_operation_name);
+        } else if (key == "ns") {
+            if (t == type::k_document) {
+                for (auto const& ns : e.get_document().value) {
+                    auto const ns_key = ns.key();
+
+                    if (ns_key == "db") {
+                        _database = get_utf8(ns);
+                    } else if (ns_key == "coll") {
+                        _collection = get_utf8(ns);
+                    }
+                }
+            }
+        } else if (key == "documentKey") {
+            if (t == type::k_document) {
+                _document_key = e.get_document().value;
+
+                // `_id` is the first field of the document key unless the collection is sharded on
+                // other fields, so this lookup rarely goes past the first element.
+                _document_key_id = (*_document_key)["_id"];
+            }
+        } else if (key == "fullDocument") {
+            if (t == type::k_document) {
+                _full_document = e.get_document().value;
+            }
+        } else if (key == "updateDescription") {
+            if (t == type::k_document) {
+                for (auto const& ud : e.get_document().value) {
+                    auto const ud_key = ud.key();
+
+                    if (ud_key == "updatedFields" && ud.type() == type::k_document) {
+                        _updated_fields = ud.get_document().value;
+                    } else if (ud_key == "removedFields" && ud.type() == type::k_array) {
+                        _removed_fields = ud.get_array().value;
+                    }
+                }
+            }
+        } else if (key == "clusterTime") {
+            if (t == type::k_timestamp) {
+                _cluster_time = e.get_timestamp();
+            }
+        }
+    }
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 #include <mongocxx/change_stream.hpp>
 
@@ -58,6 +60,23 @@ bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::view> change_stream
     return _impl->get_resume_token();
 }
 
+change_stream::batch change_stream::next_batch(std::size_t max_events) const {
+    batch ret;
+    std::vector<std::size_t> offsets;
+
+    _impl->read_batch(ret._data, offsets, ret._resume_token, max_events);
+
+    // Views are only formed once `_data` has stopped growing. Events are contiguous, so each one
+    // ends where the next one begins.
+    ret._events.reserve(offsets.size());
+    for (std::size_t i = 0u; i < offsets.size(); ++i) {
+        std::size_t const end = i + 1u < offsets.size() ? offsets[i + 1u] : ret._data.size();
+        ret._events.emplace_back(ret._data.data() + offsets[i], end - offsets[i]);
+    }
+
+    return ret;
+}
+
 // void* since we don't leak C driver defs into C++ driver
 change_stream::change_stream(void* change_stream_ptr)
     : _impl(bsoncxx::make_unique<impl>(static_cast<mongoc_change_stream_t*>(change_stream_ptr))) {}
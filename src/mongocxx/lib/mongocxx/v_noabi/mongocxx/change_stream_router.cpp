@@ -0,0 +1,258 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/builder/basic/sub_array.hpp>
+#include <bsoncxx/builder/basic/sub_document.hpp>
+
+#include <mongocxx/change_stream_router.hpp>
+#include <mongocxx/client.hpp>
+#include <mongocxx/database.hpp>
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+using bsoncxx::v_noabi::builder::basic::kvp;
+using bsoncxx::v_noabi::builder::basic::make_array;
+using bsoncxx::v_noabi::builder::basic::make_document;
+using bsoncxx::v_noabi::builder::basic::sub_array;
+using bsoncxx::v_noabi::builder::basic::sub_document;
+
+namespace mongocxx {
+namespace v_noabi {
+
+class change_stream_router::impl {
+   public:
+    struct route_type {
+        std::string database;
+        std::string collection;
+        handler fn;
+        statistics stats;
+    };
+
+    void route(std::string database, std::string collection, handler fn) {
+        if (database.empty() || collection.empty() || !fn) {
+            throw logic_error{error_code::k_invalid_parameter};
+        }
+
+        auto const iter = lower_bound(_routes, key_type{database, collection});
+
+        if (iter != _routes.end() && iter->database == database && iter->collection == collection) {
+            iter->fn = std::move(fn);
+            return;
+        }
+
+        _routes.insert(iter, route_type{std::move(database), std::move(collection), std::move(fn), statistics{}});
+    }
+
+    void fallback(handler fn) {
+        _fallback = std::move(fn);
+    }
+
+    std::size_t routes() const noexcept {
+        return _routes.size();
+    }
+
+    bsoncxx::v_noabi::document::value filter() const {
+        bsoncxx::v_noabi::builder::basic::array clauses;
+
+        // Routes are sorted by database, so the collections of each database are adjacent.
+        for (auto first = _routes.begin(); first != _routes.end();) {
+            auto const last = std::find_if(
+                first, _routes.end(), [&](route_type const& r) { return r.database != first->database; });
+
+            clauses.append([&](sub_document clause) {
+                clause.append(kvp("ns.db", first->database));
+                clause.append(kvp("ns.coll", [&](sub_document in) {
+                    in.append(kvp("$in", [&](sub_array colls) {
+                        for (auto iter = first; iter != last; ++iter) {
+                            colls.append(iter->collection);
+                        }
+                    }));
+                }));
+            });
+
+            first = last;
+        }
+
+        if (_fallback) {
+            clauses.append(make_document(kvp("ns.coll", make_document(kvp("$exists", false)))));
+        }
+
+        if (clauses.view().empty()) {
+            // Nothing is routed: match no notification.
+            return make_document(kvp("ns.coll", make_document(kvp("$in", make_array()))));
+        }
+
+        return make_document(kvp("$or", clauses.extract()));
+    }
+
+    bool dispatch(bsoncxx::v_noabi::document::view event) {
+        change_event const ce{event};
+
+        auto const collection = ce.collection();
+
+        if (collection.empty()) {
+            if (!_fallback) {
+                ++_unrouted;
+                return false;
+            }
+
+            _fallback(ce);
+            return true;
+        }
+
+        auto const r = find(_routes, key_type{ce.database(), collection});
+
+        if (!r) {
+            ++_unrouted;
+            return false;
+        }
+
+        r->fn(ce);
+
+        ++r->stats.delivered;
+        r->stats.last_cluster_time = ce.cluster_time();
+
+        return true;
+    }
+
+    bsoncxx::v_noabi::stdx::optional<statistics> stats(
+        bsoncxx::v_noabi::stdx::string_view database,
+        bsoncxx::v_noabi::stdx::string_view collection) const {
+        auto const r = find(_routes, key_type{database, collection});
+
+        if (!r) {
+            return {};
+        }
+
+        return r->stats;
+    }
+
+    std::uint64_t unrouted() const noexcept {
+        return _unrouted;
+    }
+
+   private:
+    struct key_type {
+        bsoncxx::v_noabi::stdx::string_view database;
+        bsoncxx::v_noabi::stdx::string_view collection;
+    };
+
+    static bool less(route_type const& r, key_type const& key) {
+        bsoncxx::v_noabi::stdx::string_view const database{r.database};
+        return database < key.database ||
+               (database == key.database && bsoncxx::v_noabi::stdx::string_view{r.collection} < key.collection);
+    }
+
+    // Shared by the const and non-const overloads of find().
+    template <typename Routes>
+    static auto lower_bound(Routes& routes, key_type const& key) -> decltype(routes.begin()) {
+        return std::lower_bound(routes.begin(), routes.end(), key, &impl::less);
+    }
+
+    template <typename Routes>
+    static auto find(Routes& routes, key_type const& key) -> decltype(&routes.front()) {
+        auto const iter = lower_bound(routes, key);
+
+        if (iter == routes.end() || iter->database != key.database || iter->collection != key.collection) {
+            return nullptr;
+        }
+
+        return &*iter;
+    }
+
+    std::vector<route_type> _routes; // Sorted by (database, collection).
+    handler _fallback;
+    std::uint64_t _unrouted = 0u;
+};
+
+change_stream_router::change_stream_router() : _impl(bsoncxx::make_unique<impl>()) {}
+
+change_stream_router::~change_stream_router() = default;
+
+change_stream_router::change_stream_router(change_stream_router&&) noexcept = default;
+change_stream_router& change_stream_router::operator=(change_stream_router&&) noexcept = default;
+
+change_stream_router& change_stream_router::route(
+    bsoncxx::v_noabi::string::view_or_value database,
+    bsoncxx::v_noabi::string::view_or_value collection,
+    handler handler) {
+    _impl->route(std::string{database.view()}, std::string{collection.view()}, std::move(handler));
+    return *this;
+}
+
+change_stream_router& change_stream_router::fallback(handler handler) {
+    _impl->fallback(std::move(handler));
+    return *this;
+}
+
+std::size_t change_stream_router::routes() const noexcept {
+    return _impl->routes();
+}
+
+bsoncxx::v_noabi::document::value change_stream_router::filter() const {
+    return _impl->filter();
+}
+
+change_stream change_stream_router::watch(database& db, pipeline const& pipe, options::change_stream const& options)
+    const {
+    pipeline routed;
+    routed.match(filter());
+    routed.append_stages(pipe.view_array());
+    return db.watch(routed, options);
+}
+
+change_stream change_stream_router::watch(client& client, pipeline const& pipe, options::change_stream const& options)
+    const {
+    pipeline routed;
+    routed.match(filter());
+    routed.append_stages(pipe.view_array());
+    return client.watch(routed, options);
+}
+
+bool change_stream_router::dispatch(bsoncxx::v_noabi::document::view event) {
+    return _impl->dispatch(event);
+}
+
+std::size_t change_stream_router::dispatch(change_stream::batch const& batch) {
+    std::size_t ret = 0u;
+
+    for (auto const& event : batch) {
+        ret += _impl->dispatch(event) ? 1u : 0u;
+    }
+
+    return ret;
+}
+
+bsoncxx::v_noabi::stdx::optional<change_stream_router::statistics> change_stream_router::stats(
+    bsoncxx::v_noabi::stdx::string_view database,
+    bsoncxx::v_noabi::stdx::string_view collection) const {
+    return _impl->stats(database, collection);
+}
+
+std::uint64_t change_stream_router::unrouted() const noexcept {
+    return _impl->unrouted();
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
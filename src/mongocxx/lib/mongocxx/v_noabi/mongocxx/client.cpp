@@ -27,8 +27,11 @@
 #include <bsoncxx/private/make_unique.hh>
 
 #include <mongocxx/private/bson.hh>
+#include <mongocxx/private/change_stream.hh>
 #include <mongocxx/private/client.hh>
 #include <mongocxx/private/client_session.hh>
+#include <mongocxx/private/collection.hh>
+#include <mongocxx/private/database.hh>
 #include <mongocxx/private/mongoc_error.hh>
 #include <mongocxx/private/pipeline.hh>
 #include <mongocxx/private/read_concern.hh>
@@ -152,6 +155,8 @@ client::operator bool() const noexcept {
 void client::read_concern_deprecated(mongocxx::v_noabi::read_concern rc) {
     auto client_t = _get_impl().client_t;
     libmongoc::client_set_read_concern(client_t, rc._impl->read_concern_t);
+    // Cached handles inherited the previous settings.
+    _get_impl().handles.concerns_changed();
 }
 
 void client::read_concern(mongocxx::v_noabi::read_concern rc) {
@@ -165,6 +170,8 @@ mongocxx::v_noabi::read_concern client::read_concern() const {
 
 void client::read_preference_deprecated(mongocxx::v_noabi::read_preference rp) {
     libmongoc::client_set_read_prefs(_get_impl().client_t, rp._impl->read_preference_t);
+    // Cached handles inherited the previous settings.
+    _get_impl().handles.concerns_changed();
 }
 
 void client::read_preference(mongocxx::v_noabi::read_preference rp) {
@@ -186,6 +193,8 @@ mongocxx::v_noabi::uri client::uri() const {
 
 void client::write_concern_deprecated(mongocxx::v_noabi::write_concern wc) {
     libmongoc::client_set_write_concern(_get_impl().client_t, wc._impl->write_concern_t);
+    // Cached handles inherited the previous settings.
+    _get_impl().handles.concerns_changed();
 }
 
 void client::write_concern(mongocxx::v_noabi::write_concern wc) {
@@ -203,6 +212,26 @@ mongocxx::v_noabi::database client::database(bsoncxx::v_noabi::string::view_or_v
     return mongocxx::v_noabi::database(*this, std::move(name));
 }
 
+mongocxx::v_noabi::database& client::cached_database(bsoncxx::v_noabi::stdx::string_view name) & {
+    mongocxx::v_noabi::database& handle = _get_impl().handles.database(*this, name);
+    handle._get_impl().cached = true;
+    return handle;
+}
+
+mongocxx::v_noabi::collection& client::cached_collection(
+    bsoncxx::v_noabi::stdx::string_view database_name,
+    bsoncxx::v_noabi::stdx::string_view collection_name) & {
+    mongocxx::v_noabi::collection& handle = _get_impl().handles.collection(*this, database_name, collection_name);
+    handle._get_impl().cached = true;
+    return handle;
+}
+
+void client::clear_cached_handles() noexcept {
+    if (_impl) {
+        _impl->handles.clear();
+    }
+}
+
 cursor client::list_databases() const {
     return libmongoc::client_find_databases_with_opts(_get_impl().client_t, nullptr);
 }
@@ -316,7 +345,13 @@ client::_watch(client_session const* session, pipeline const& pipe, options::cha
 
     scoped_bson_t options_bson{options_builder.extract()};
 
-    return change_stream{libmongoc::client_watch(_get_impl().client_t, pipeline_bson.bson(), options_bson.bson())};
+    // The aggregate opening the stream returns its first batch.
+    change_stream_batch first_batch;
+    change_stream_batch::scope scope{first_batch};
+
+    change_stream ret{libmongoc::client_watch(_get_impl().client_t, pipeline_bson.bson(), options_bson.bson())};
+    ret._impl->batch() = first_batch;
+    return ret;
 }
 
 client::impl const& client::_get_impl() const {
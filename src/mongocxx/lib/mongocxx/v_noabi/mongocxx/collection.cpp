@@ -50,11 +50,14 @@
 
 #include <mongocxx/private/bson.hh>
 #include <mongocxx/private/bulk_write.hh>
+#include <mongocxx/private/cached_handle.hh>
+#include <mongocxx/private/change_stream.hh>
 #include <mongocxx/private/client_session.hh>
 #include <mongocxx/private/collection.hh>
 #include <mongocxx/private/cursor.hh>
 #include <mongocxx/private/mongoc.hh>
 #include <mongocxx/private/mongoc_error.hh>
+#include <mongocxx/private/operation_timing.hh>
 #include <mongocxx/private/pipeline.hh>
 #include <mongocxx/private/read_concern.hh>
 #include <mongocxx/private/read_preference.hh>
@@ -201,7 +204,22 @@ using namespace libbson;
 
 collection::collection() noexcept = default;
 collection::collection(collection&&) noexcept = default;
-collection& collection::operator=(collection&&) noexcept = default;
+
+collection& collection::operator=(collection&& c) {
+    if (*this) {
+        check_not_cached(_get_impl().cached);
+    }
+
+    // Moving from a cached handle would take it from every other caller of the client.
+    if (c && c._get_impl().cached) {
+        return *this = c;
+    }
+
+    _impl = std::move(c._impl);
+
+    return *this;
+}
+
 collection::~collection() = default;
 
 collection::operator bool() const noexcept {
@@ -217,6 +235,8 @@ void collection::_rename(
     bsoncxx::v_noabi::string::view_or_value new_name,
     bool drop_target_before_rename,
     bsoncxx::v_noabi::stdx::optional<mongocxx::v_noabi::write_concern> const& wc) {
+    check_not_cached(_get_impl().cached);
+
     bson_error_t error;
 
     bsoncxx::v_noabi::builder::basic::document opts_doc;
@@ -279,6 +299,10 @@ collection::collection(collection const& c) {
 }
 
 collection& collection::operator=(collection const& c) {
+    if (*this) {
+        check_not_cached(_get_impl().cached);
+    }
+
     if (!c) {
         _impl.reset();
     } else if (!*this) {
@@ -394,6 +418,8 @@ bsoncxx::v_noabi::builder::basic::document build_find_options_document(options::
 } // namespace
 
 cursor collection::_find(client_session const* session, view_or_value filter, options::find const& options) {
+    operation_phase phase{operation_timing::k_prepare};
+
     scoped_bson_t filter_bson{std::move(filter)};
 
     mongoc_read_prefs_t const* rp_ptr = nullptr;
@@ -408,10 +434,14 @@ cursor collection::_find(client_session const* session, view_or_value filter, op
 
     scoped_bson_t options_bson{options_builder.extract()};
 
+    phase.enter(operation_timing::k_libmongoc);
+
     cursor query_cursor{
         libmongoc::collection_find_with_opts(_get_impl().collection_t, filter_bson.bson(), options_bson.bson(), rp_ptr),
         options.cursor_type()};
 
+    phase.enter(operation_timing::k_prepare);
+
     if (options.max_await_time()) {
         auto const count = options.max_await_time()->count();
         if ((count < 0) || (count >= std::numeric_limits<std::uint32_t>::max())) {
@@ -433,6 +463,7 @@ cursor collection::find(client_session const& session, view_or_value filter, opt
 
 bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>
 collection::_find_one(client_session const* session, view_or_value filter, options::find const& options) {
+    operation_phase phase{operation_timing::k_prepare};
     options::find copy(options);
     copy.limit(1);
     cursor cursor = session ? find(*session, std::move(filter), copy) : find(std::move(filter), copy);
@@ -440,6 +471,7 @@ collection::_find_one(client_session const* session, view_or_value filter, optio
     if (it == cursor.end()) {
         return bsoncxx::v_noabi::stdx::nullopt;
     }
+    phase.enter(operation_timing::k_results);
     return bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>(bsoncxx::v_noabi::document::value{*it});
 }
 
@@ -1321,6 +1353,7 @@ void collection::drop(
 }
 
 void collection::read_concern(mongocxx::v_noabi::read_concern rc) {
+    check_not_cached(_get_impl().cached);
     libmongoc::collection_set_read_concern(_get_impl().collection_t, rc._impl->read_concern_t);
 }
 
@@ -1330,6 +1363,7 @@ mongocxx::v_noabi::read_concern collection::read_concern() const {
 }
 
 void collection::read_preference(mongocxx::v_noabi::read_preference rp) {
+    check_not_cached(_get_impl().cached);
     libmongoc::collection_set_read_prefs(_get_impl().collection_t, rp._impl->read_preference_t);
 }
 
@@ -1341,6 +1375,7 @@ mongocxx::v_noabi::read_preference collection::read_preference() const {
 }
 
 void collection::write_concern(mongocxx::v_noabi::write_concern wc) {
+    check_not_cached(_get_impl().cached);
     libmongoc::collection_set_write_concern(_get_impl().collection_t, wc._impl->write_concern_t);
 }
 
@@ -1383,8 +1418,13 @@ collection::_watch(client_session const* session, pipeline const& pipe, options:
     scoped_bson_t options_bson{options_builder.extract()};
 
     // NOTE: collection_watch copies what it needs so we're safe to destroy our copies.
-    return change_stream{
-        libmongoc::collection_watch(_get_impl().collection_t, pipeline_bson.bson(), options_bson.bson())};
+    // The aggregate opening the stream returns its first batch.
+    change_stream_batch first_batch;
+    change_stream_batch::scope scope{first_batch};
+
+    change_stream ret{libmongoc::collection_watch(_get_impl().collection_t, pipeline_bson.bson(), options_bson.bson())};
+    ret._impl->batch() = first_batch;
+    return ret;
 }
 
 index_view collection::indexes() {
@@ -0,0 +1,157 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/command_filter.hpp>
+
+//
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+
+namespace {
+
+// The decision made for the last started event of this thread. The started event and the succeeded
+// or failed event of a command are published by the thread running the command, with no other
+// command in between.
+struct started_decision {
+    void const* filter;
+    std::int64_t request_id;
+    bool accepted;
+};
+
+thread_local started_decision last_started = {nullptr, 0, false};
+
+bool contains(std::vector<std::string> const& names, bsoncxx::v_noabi::stdx::string_view name) {
+    return std::any_of(names.begin(), names.end(), [&](std::string const& s) { return name == s; });
+}
+
+} // namespace
+
+class command_filter::impl {
+   public:
+    impl() : _one_in{1}, _filtered{0} {}
+
+    void sample(std::uint32_t one_in) {
+        if (one_in == 0) {
+            throw logic_error{error_code::k_invalid_parameter};
+        }
+
+        _one_in = one_in;
+    }
+
+    void ignore_command(std::string command_name) {
+        _ignored_commands.push_back(std::move(command_name));
+    }
+
+    void monitor_database(std::string database_name) {
+        _databases.push_back(std::move(database_name));
+    }
+
+    template <typename Event>
+    bool accepts_started(Event const& event) noexcept {
+        bool const accepted = decide(event.command_name(), event.request_id()) &&
+                              (_databases.empty() || contains(_databases, event.database_name()));
+
+        last_started = {this, event.request_id(), accepted};
+
+        return count(accepted);
+    }
+
+    template <typename Event>
+    bool accepts_finished(Event const& event) noexcept {
+        std::int64_t const request_id = event.request_id();
+
+        if (last_started.filter == this && last_started.request_id == request_id) {
+            return count(last_started.accepted);
+        }
+
+        // The started event was not seen by this filter: decide without the database name.
+        return count(decide(event.command_name(), request_id));
+    }
+
+    std::uint64_t filtered() const noexcept {
+        return _filtered.load(std::memory_order_relaxed);
+    }
+
+   private:
+    bool decide(bsoncxx::v_noabi::stdx::string_view command_name, std::int64_t request_id) const noexcept {
+        if (_one_in > 1u && static_cast<std::uint64_t>(request_id) % _one_in != 0u) {
+            return false;
+        }
+
+        return !contains(_ignored_commands, command_name);
+    }
+
+    bool count(bool accepted) noexcept {
+        if (!accepted) {
+            _filtered.fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        return accepted;
+    }
+
+    std::uint32_t _one_in;
+    std::vector<std::string> _ignored_commands;
+    std::vector<std::string> _databases;
+    std::atomic<std::uint64_t> _filtered;
+};
+
+command_filter::command_filter() : _impl{bsoncxx::make_unique<impl>()} {}
+
+command_filter::~command_filter() = default;
+
+command_filter& command_filter::sample(std::uint32_t one_in) {
+    _impl->sample(one_in);
+    return *this;
+}
+
+command_filter& command_filter::ignore_command(bsoncxx::v_noabi::string::view_or_value command_name) {
+    _impl->ignore_command(std::string{command_name.view()});
+    return *this;
+}
+
+command_filter& command_filter::monitor_database(bsoncxx::v_noabi::string::view_or_value database_name) {
+    _impl->monitor_database(std::string{database_name.view()});
+    return *this;
+}
+
+bool command_filter::accepts(events::command_started_event const& event) noexcept {
+    return _impl->accepts_started(event);
+}
+
+bool command_filter::accepts(events::command_succeeded_event const& event) noexcept {
+    return _impl->accepts_finished(event);
+}
+
+bool command_filter::accepts(events::command_failed_event const& event) noexcept {
+    return _impl->accepts_finished(event);
+}
+
+std::uint64_t command_filter::filtered() const noexcept {
+    return _impl->filtered();
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
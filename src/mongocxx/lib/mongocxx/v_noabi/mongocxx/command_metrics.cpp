@@ -0,0 +1,506 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/command_metrics.hpp>
+
+//
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/private/make_unique.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+
+namespace {
+
+using bucket_bounds_type = std::array<std::int64_t, command_metrics::k_bucket_count - 1>;
+
+bucket_bounds_type const k_bucket_bounds = {{
+    50,
+    100,
+    250,
+    500,
+    1000,
+    2500,
+    5000,
+    10000,
+    25000,
+    50000,
+    100000,
+    250000,
+    500000,
+    1000000,
+    2500000,
+    5000000,
+    10000000,
+}};
+
+// The counters of a (command, host) pair recorded by a single thread. Counters are only written by
+// the owning thread, so a relaxed load followed by a relaxed store is sufficient.
+struct cell {
+    cell(std::string command_name, std::string host)
+        : command_name{std::move(command_name)}, host{std::move(host)}, count{0}, failures{0}, sum{0}, next{nullptr} {
+        for (auto& bucket : buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::string const command_name;
+    std::string const host;
+    std::atomic<std::uint64_t> count;
+    std::atomic<std::uint64_t> failures;
+    std::atomic<std::uint64_t> sum;
+    std::array<std::atomic<std::uint64_t>, command_metrics::k_bucket_count> buckets;
+
+    // Immutable once the cell is published.
+    cell* next;
+};
+
+void increment(std::atomic<std::uint64_t>& counter, std::uint64_t n) {
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+// The cells recorded by a single thread. Cells are only added by the owning thread and are published
+// by prepending them to a list which readers traverse without locking.
+//
+// A shard is released by its collector when the collector is destroyed and by its owning thread when
+// the thread exits, whichever comes last deletes it. A shard released by its thread is kept in the
+// list of its collector, so that its cells remain readable, and is adopted by the next thread which
+// records into the collector without a shard.
+struct shard {
+    explicit shard(std::uint64_t owner) : owner{owner}, cells{nullptr}, next{nullptr}, refs{2} {}
+
+    ~shard() {
+        cell* c = cells.load(std::memory_order_relaxed);
+
+        while (c) {
+            cell* const next_cell = c->next;
+            delete c;
+            c = next_cell;
+        }
+    }
+
+    shard(shard const&) = delete;
+    shard& operator=(shard const&) = delete;
+
+    static void release(shard* s) noexcept {
+        if (s->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete s;
+        }
+    }
+
+    // The identifier of the owning thread, or 0 if the shard is free. The release by the exiting
+    // thread and the acquire by the adopting thread order their accesses to the cells and the index.
+    std::atomic<std::uint64_t> owner;
+
+    // Only accessed by the owning thread. Keyed by `command_name + '\0' + host`.
+    std::unordered_map<std::string, cell*> index;
+
+    std::atomic<cell*> cells;
+
+    // Immutable once the shard is published.
+    shard* next;
+
+    std::atomic<int> refs;
+};
+
+// Unique, never reused identifiers of collectors and threads. A thread's cached shard can therefore
+// never be confused with a shard of another collector or of an exited thread.
+std::atomic<std::uint64_t> next_collector_id{1};
+std::atomic<std::uint64_t> next_thread_id{1};
+
+std::uint64_t this_thread_id() {
+    static thread_local std::uint64_t const id = next_thread_id.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+// The shards owned by this thread, freed for reuse when the thread exits.
+class owned_shards {
+   public:
+    owned_shards() = default;
+
+    ~owned_shards() {
+        for (shard* const s : _shards) {
+            s->owner.store(0u, std::memory_order_release);
+            shard::release(s);
+        }
+    }
+
+    owned_shards(owned_shards const&) = delete;
+    owned_shards& operator=(owned_shards const&) = delete;
+
+    // Takes a reference to the shard. The shards of destroyed collectors are only referenced by this
+    // thread: they are deleted beforehand so that they do not accumulate.
+    void add(shard* s) {
+        auto const unreferenced = std::partition(_shards.begin(), _shards.end(), [](shard const* owned) {
+            return owned->refs.load(std::memory_order_acquire) != 1;
+        });
+
+        for (auto it = unreferenced; it != _shards.end(); ++it) {
+            delete *it;
+        }
+
+        _shards.erase(unreferenced, _shards.end());
+        _shards.push_back(s);
+    }
+
+   private:
+    std::vector<shard*> _shards;
+};
+
+thread_local owned_shards this_thread_shards;
+
+struct cache_entry {
+    std::uint64_t collector_id;
+    shard* s;
+};
+
+// A small direct-mapped cache of the shards of this thread. Entries of destroyed collectors are
+// never matched again and are eventually overwritten.
+constexpr std::size_t k_cache_size = 8;
+
+thread_local cache_entry shard_cache[k_cache_size] = {};
+
+// Reused to build lookup keys without allocating.
+thread_local std::string key_buffer;
+
+std::size_t bucket_index(std::int64_t duration) {
+    return static_cast<std::size_t>(
+        std::lower_bound(k_bucket_bounds.begin(), k_bucket_bounds.end(), duration) - k_bucket_bounds.begin());
+}
+
+// Writes a duration in microseconds as a decimal number of seconds without trailing zeroes.
+void append_seconds(std::string& out, std::uint64_t microseconds) {
+    out += std::to_string(microseconds / 1000000u);
+
+    std::uint64_t fraction = microseconds % 1000000u;
+
+    if (fraction == 0) {
+        return;
+    }
+
+    char digits[7] = {'0', '0', '0', '0', '0', '0', '\0'};
+
+    for (int i = 5; i >= 0; --i) {
+        digits[i] = static_cast<char>('0' + fraction % 10u);
+        fraction /= 10u;
+    }
+
+    std::size_t length = 6;
+
+    while (digits[length - 1] == '0') {
+        --length;
+    }
+
+    out += '.';
+    out.append(digits, length);
+}
+
+void append_label_value(std::string& out, std::string const& value) {
+    for (char const c : value) {
+        switch (c) {
+            case '\\':
+                out += "\\\\";
+                break;
+            case '"':
+                out += "\\\"";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            default:
+                out += c;
+                break;
+        }
+    }
+}
+
+void append_labels(std::string& out, command_metrics::series const& s) {
+    out += "command=\"";
+    append_label_value(out, s.command_name);
+    out += "\",host=\"";
+    append_label_value(out, s.host);
+    out += '"';
+}
+
+} // namespace
+
+class command_metrics::impl {
+   public:
+    impl() : _id{next_collector_id.fetch_add(1, std::memory_order_relaxed)}, _shards{nullptr} {}
+
+    ~impl() {
+        shard* s = _shards.load(std::memory_order_relaxed);
+
+        while (s) {
+            shard* const next_shard = s->next;
+            shard::release(s);
+            s = next_shard;
+        }
+    }
+
+    impl(impl const&) = delete;
+    impl& operator=(impl const&) = delete;
+
+    void record(bsoncxx::v_noabi::stdx::string_view command_name,
+                bsoncxx::v_noabi::stdx::string_view host,
+                std::int64_t duration,
+                bool failed) {
+        shard& s = this_shard();
+
+        key_buffer.assign(command_name.data(), command_name.size());
+        key_buffer += '\0';
+        key_buffer.append(host.data(), host.size());
+
+        auto iter = s.index.find(key_buffer);
+
+        if (iter == s.index.end()) {
+            iter = s.index.emplace(key_buffer, nullptr).first;
+
+            try {
+                iter->second = new cell{std::string{command_name}, std::string{host}};
+            } catch (...) {
+                s.index.erase(iter);
+                throw;
+            }
+
+            iter->second->next = s.cells.load(std::memory_order_relaxed);
+            s.cells.store(iter->second, std::memory_order_release);
+        }
+
+        cell& c = *iter->second;
+
+        if (duration < 0) {
+            duration = 0;
+        }
+
+        increment(c.count, 1u);
+        increment(c.sum, static_cast<std::uint64_t>(duration));
+        increment(c.buckets[bucket_index(duration)], 1u);
+
+        if (failed) {
+            increment(c.failures, 1u);
+        }
+    }
+
+    std::vector<series> snapshot() const {
+        std::map<std::pair<std::string, std::string>, series> merged;
+
+        for (shard* s = _shards.load(std::memory_order_acquire); s; s = s->next) {
+            for (cell* c = s->cells.load(std::memory_order_acquire); c; c = c->next) {
+                auto const key = std::make_pair(c->command_name, c->host);
+                auto iter = merged.find(key);
+
+                if (iter == merged.end()) {
+                    series init{c->command_name, c->host, 0u, 0u, 0u, {}};
+                    iter = merged.emplace(key, std::move(init)).first;
+                }
+
+                series& out = iter->second;
+
+                out.count += c->count.load(std::memory_order_relaxed);
+                out.failures += c->failures.load(std::memory_order_relaxed);
+                out.sum_microseconds += c->sum.load(std::memory_order_relaxed);
+
+                for (std::size_t i = 0; i < k_bucket_count; ++i) {
+                    out.buckets[i] += c->buckets[i].load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::vector<series> ret;
+        ret.reserve(merged.size());
+
+        for (auto& entry : merged) {
+            ret.push_back(std::move(entry.second));
+        }
+
+        return ret;
+    }
+
+   private:
+    shard& this_shard() {
+        cache_entry& entry = shard_cache[_id % k_cache_size];
+
+        if (entry.collector_id == _id) {
+            return *entry.s;
+        }
+
+        std::uint64_t const owner = this_thread_id();
+        shard* found = nullptr;
+        shard* free_shard = nullptr;
+
+        // The shard of this thread may have been evicted from the cache.
+        for (shard* s = _shards.load(std::memory_order_acquire); s; s = s->next) {
+            std::uint64_t const s_owner = s->owner.load(std::memory_order_relaxed);
+
+            if (s_owner == owner) {
+                found = s;
+                break;
+            }
+
+            if (s_owner == 0u && !free_shard) {
+                free_shard = s;
+            }
+        }
+
+        if (!found) {
+            found = adopt(free_shard, owner);
+        }
+
+        entry.collector_id = _id;
+        entry.s = found;
+
+        return *found;
+    }
+
+    // Adopts a shard freed by an exited thread, if any, or else publishes a new shard.
+    shard* adopt(shard* first, std::uint64_t owner) {
+        for (shard* s = first; s; s = s->next) {
+            std::uint64_t expected = 0u;
+
+            if (s->owner.load(std::memory_order_relaxed) == 0u &&
+                s->owner.compare_exchange_strong(expected, owner, std::memory_order_acquire)) {
+                s->refs.fetch_add(1, std::memory_order_relaxed);
+
+                try {
+                    this_thread_shards.add(s);
+                } catch (...) {
+                    s->owner.store(0u, std::memory_order_release);
+                    shard::release(s);
+                    throw;
+                }
+
+                return s;
+            }
+        }
+
+        std::unique_ptr<shard> added{new shard{owner}};
+
+        this_thread_shards.add(added.get());
+
+        shard* const s = added.release();
+
+        s->next = _shards.load(std::memory_order_relaxed);
+
+        while (!_shards.compare_exchange_weak(s->next, s, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+
+        return s;
+    }
+
+    std::uint64_t const _id;
+    std::atomic<shard*> _shards;
+};
+
+constexpr std::size_t command_metrics::k_bucket_count;
+
+command_metrics::command_metrics() : _impl{bsoncxx::make_unique<impl>()} {}
+
+command_metrics::~command_metrics() = default;
+
+std::array<std::int64_t, command_metrics::k_bucket_count - 1> const& command_metrics::bucket_bounds() noexcept {
+    return k_bucket_bounds;
+}
+
+void command_metrics::record(
+    bsoncxx::v_noabi::stdx::string_view command_name,
+    bsoncxx::v_noabi::stdx::string_view host,
+    std::int64_t duration_microseconds,
+    bool failed) noexcept {
+    try {
+        _impl->record(command_name, host, duration_microseconds, failed);
+    } catch (std::bad_alloc const&) {
+        // Drop the recording rather than fail the command.
+    }
+}
+
+std::vector<command_metrics::series> command_metrics::snapshot() const {
+    return _impl->snapshot();
+}
+
+std::string command_metrics::to_prometheus(bsoncxx::v_noabi::stdx::string_view prefix) const {
+    auto const all = snapshot();
+
+    std::string const duration_name = std::string{prefix} + "_duration_seconds";
+    std::string const failures_name = std::string{prefix} + "_failures_total";
+
+    std::string out;
+
+    out += "# HELP " + duration_name + " Duration of the commands sent by the driver.\n";
+    out += "# TYPE " + duration_name + " histogram\n";
+
+    for (auto const& s : all) {
+        std::uint64_t cumulative = 0;
+
+        for (std::size_t i = 0; i < k_bucket_count; ++i) {
+            cumulative += s.buckets[i];
+
+            out += duration_name;
+            out += "_bucket{";
+            append_labels(out, s);
+            out += ",le=\"";
+
+            if (i < k_bucket_bounds.size()) {
+                append_seconds(out, static_cast<std::uint64_t>(k_bucket_bounds[i]));
+            } else {
+                out += "+Inf";
+            }
+
+            out += "\"} ";
+            out += std::to_string(cumulative);
+            out += '\n';
+        }
+
+        out += duration_name;
+        out += "_sum{";
+        append_labels(out, s);
+        out += "} ";
+        append_seconds(out, s.sum_microseconds);
+        out += '\n';
+
+        out += duration_name;
+        out += "_count{";
+        append_labels(out, s);
+        out += "} ";
+        out += std::to_string(s.count);
+        out += '\n';
+    }
+
+    out += "# HELP " + failures_name + " Number of the commands sent by the driver which failed.\n";
+    out += "# TYPE " + failures_name + " counter\n";
+
+    for (auto const& s : all) {
+        out += failures_name;
+        out += '{';
+        append_labels(out, s);
+        out += "} ";
+        out += std::to_string(s.failures);
+        out += '\n';
+    }
+
+    return out;
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
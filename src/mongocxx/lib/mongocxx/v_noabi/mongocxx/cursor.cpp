@@ -21,6 +21,7 @@
 #include <mongocxx/private/cursor.hh>
 #include <mongocxx/private/mongoc.hh>
 #include <mongocxx/private/mongoc_error.hh>
+#include <mongocxx/private/operation_timing.hh>
 
 namespace mongocxx {
 namespace v_noabi {
@@ -42,7 +43,10 @@ cursor::iterator& cursor::iterator::operator++() {
     bson_t const* error_document;
     bson_error_t error;
 
+    operation_phase phase{operation_timing::k_libmongoc};
+
     if (libmongoc::cursor_next(_cursor->_impl->cursor_t, &out)) {
+        phase.enter(operation_timing::k_results);
         _cursor->_impl->doc = bsoncxx::v_noabi::document::view{bson_get_data(out), out->len};
     } else if (libmongoc::cursor_error_document(_cursor->_impl->cursor_t, &error, &error_document)) {
         _cursor->_impl->mark_dead();
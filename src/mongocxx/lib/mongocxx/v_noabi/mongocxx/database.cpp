@@ -28,6 +28,8 @@
 #include <bsoncxx/private/make_unique.hh>
 
 #include <mongocxx/private/bson.hh>
+#include <mongocxx/private/cached_handle.hh>
+#include <mongocxx/private/change_stream.hh>
 #include <mongocxx/private/client.hh>
 #include <mongocxx/private/client_session.hh>
 #include <mongocxx/private/database.hh>
@@ -81,7 +83,21 @@ using namespace libbson;
 database::database() noexcept = default;
 
 database::database(database&&) noexcept = default;
-database& database::operator=(database&&) noexcept = default;
+
+database& database::operator=(database&& d) {
+    if (*this) {
+        check_not_cached(_get_impl().cached);
+    }
+
+    // Moving from a cached handle would take it from every other caller of the client.
+    if (d && d._get_impl().cached) {
+        return *this = d;
+    }
+
+    _impl = std::move(d._impl);
+
+    return *this;
+}
 
 database::~database() = default;
 
@@ -99,6 +115,10 @@ database::database(database const& d) {
 }
 
 database& database::operator=(database const& d) {
+    if (*this) {
+        check_not_cached(_get_impl().cached);
+    }
+
     if (!d) {
         _impl.reset();
     } else if (!*this) {
@@ -340,6 +360,7 @@ void database::drop(
 }
 
 void database::read_concern(mongocxx::v_noabi::read_concern rc) {
+    check_not_cached(_get_impl().cached);
     libmongoc::database_set_read_concern(_get_impl().database_t, rc._impl->read_concern_t);
 }
 
@@ -349,6 +370,7 @@ mongocxx::v_noabi::read_concern database::read_concern() const {
 }
 
 void database::read_preference(mongocxx::v_noabi::read_preference rp) {
+    check_not_cached(_get_impl().cached);
     libmongoc::database_set_read_prefs(_get_impl().database_t, rp._impl->read_preference_t);
 }
 
@@ -370,6 +392,7 @@ mongocxx::v_noabi::read_preference database::read_preference() const {
 }
 
 void database::write_concern(mongocxx::v_noabi::write_concern wc) {
+    check_not_cached(_get_impl().cached);
     libmongoc::database_set_write_concern(_get_impl().database_t, wc._impl->write_concern_t);
 }
 
@@ -419,7 +442,13 @@ database::_watch(client_session const* session, pipeline const& pipe, options::c
 
     scoped_bson_t options_bson{options_builder.extract()};
 
-    return change_stream{libmongoc::database_watch(_get_impl().database_t, pipeline_bson.bson(), options_bson.bson())};
+    // The aggregate opening the stream returns its first batch.
+    change_stream_batch first_batch;
+    change_stream_batch::scope scope{first_batch};
+
+    change_stream ret{libmongoc::database_watch(_get_impl().database_t, pipeline_bson.bson(), options_bson.bson())};
+    ret._impl->batch() = first_batch;
+    return ret;
 }
 
 database::impl const& database::_get_impl() const {
@@ -0,0 +1,78 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/operation_timer.hpp>
+
+//
+
+#include <bsoncxx/private/make_unique.hh>
+
+#include <mongocxx/private/operation_timing.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+
+class operation_timer::impl {
+   public:
+    impl() : previous{operation_timing::current()} {}
+
+    operation_timing timing;
+    operation_timing* const previous;
+};
+
+operation_timer::operation_timer() : _impl{bsoncxx::make_unique<impl>()} {
+    // Charge the time so far to the suspended timer, if any.
+    if (_impl->previous) {
+        _impl->previous->enter(_impl->previous->active);
+    }
+
+    operation_timing::current() = &_impl->timing;
+}
+
+operation_timer::~operation_timer() {
+    operation_timing::current() = _impl->previous;
+
+    // The suspended timer does not record the lifetime of this one.
+    if (_impl->previous) {
+        _impl->previous->since = operation_timing::clock::now();
+    }
+}
+
+operation_timer::breakdown operation_timer::phases() const noexcept {
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    operation_timing const& timing = _impl->timing;
+
+    auto const libmongoc = duration_cast<nanoseconds>(timing.totals[operation_timing::k_libmongoc]);
+    auto const server = duration_cast<nanoseconds>(timing.server);
+
+    breakdown ret;
+
+    ret.prepare = duration_cast<nanoseconds>(timing.totals[operation_timing::k_prepare]);
+    // Durations reported by command monitoring are measured by libmongoc with a coarser clock.
+    ret.driver = libmongoc > server ? libmongoc - server : nanoseconds::zero();
+    ret.server = server;
+    ret.results = duration_cast<nanoseconds>(timing.totals[operation_timing::k_results]);
+    ret.commands = timing.commands;
+
+    return ret;
+}
+
+void operation_timer::reset() noexcept {
+    _impl->timing.reset();
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
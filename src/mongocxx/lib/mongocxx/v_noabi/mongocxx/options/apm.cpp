@@ -142,6 +142,87 @@ std::function<void MONGOCXX_ABI_CDECL(events::heartbeat_succeeded_event const&)>
     return _heartbeat_succeeded;
 }
 
+apm& apm::metrics(std::shared_ptr<command_metrics> metrics) {
+    _metrics = std::move(metrics);
+    return *this;
+}
+
+std::shared_ptr<command_metrics> const& apm::metrics() const {
+    return _metrics;
+}
+
+apm& apm::dispatcher(std::shared_ptr<apm_dispatcher> dispatcher) {
+    _dispatcher = std::move(dispatcher);
+    return *this;
+}
+
+std::shared_ptr<apm_dispatcher> const& apm::dispatcher() const {
+    return _dispatcher;
+}
+
+apm& apm::filter(std::shared_ptr<command_filter> filter) {
+    _filter = std::move(filter);
+    return *this;
+}
+
+std::shared_ptr<command_filter> const& apm::filter() const {
+    return _filter;
+}
+
+apm& apm::tracer(std::shared_ptr<tracing::tracer> tracer) {
+    _tracer = std::move(tracer);
+    return *this;
+}
+
+std::shared_ptr<tracing::tracer> const& apm::tracer() const {
+    return _tracer;
+}
+
+apm& apm::slow_log(std::shared_ptr<slow_command_log> slow_log) {
+    _slow_log = std::move(slow_log);
+    return *this;
+}
+
+std::shared_ptr<slow_command_log> const& apm::slow_log() const {
+    return _slow_log;
+}
+
+apm& apm::operation_timing(bool enabled) {
+    _operation_timing = enabled;
+    return *this;
+}
+
+bool apm::operation_timing() const {
+    return _operation_timing;
+}
+
+apm& apm::change_stream_batches(bool enabled) {
+    _change_stream_batches = enabled;
+    return *this;
+}
+
+bool apm::change_stream_batches() const {
+    return _change_stream_batches;
+}
+
+apm& apm::cached_topology(std::shared_ptr<topology_cache> cache) {
+    _cached_topology = std::move(cache);
+    return *this;
+}
+
+std::shared_ptr<topology_cache> const& apm::cached_topology() const {
+    return _cached_topology;
+}
+
+apm& apm::server_stats(std::shared_ptr<server_statistics> stats) {
+    _server_stats = std::move(stats);
+    return *this;
+}
+
+std::shared_ptr<server_statistics> const& apm::server_stats() const {
+    return _server_stats;
+}
+
 } // namespace options
 } // namespace v_noabi
 } // namespace mongocxx
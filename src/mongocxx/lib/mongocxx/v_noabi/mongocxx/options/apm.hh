@@ -20,7 +20,17 @@
 
 #include <iostream>
 
+#include <mongocxx/apm_dispatcher.hpp>
+#include <mongocxx/command_filter.hpp>
+#include <mongocxx/command_metrics.hpp>
+#include <mongocxx/server_statistics.hpp>
+#include <mongocxx/slow_command_log.hpp>
+#include <mongocxx/topology_cache.hpp>
+#include <mongocxx/tracing/tracer.hpp>
+
+#include <mongocxx/private/change_stream_batch.hh>
 #include <mongocxx/private/mongoc.hh>
+#include <mongocxx/private/operation_timing.hh>
 
 namespace mongocxx {
 namespace v_noabi {
@@ -43,19 +53,121 @@ inline void exception_guard(char const* source, Fn fn) noexcept {
 inline void command_started(mongoc_apm_command_started_t const* event) noexcept {
     events::command_started_event started_event(static_cast<void const*>(event));
     auto context = static_cast<apm*>(libmongoc::apm_command_started_get_context(event));
-    exception_guard(__func__, [&] { context->command_started()(started_event); });
+
+    if (auto const& slow_log = context->slow_log()) {
+        slow_log->start(started_event);
+    }
+
+    if (auto const& stats = context->server_stats()) {
+        stats->record(started_event);
+    }
+
+    if (context->filter() && !context->filter()->accepts(started_event)) {
+        return;
+    }
+
+    if (auto const& tracer = context->tracer()) {
+        tracer->start(started_event);
+    }
+
+    if (auto const& dispatcher = context->dispatcher()) {
+        dispatcher->post(started_event);
+    }
+
+    if (context->command_started()) {
+        exception_guard(__func__, [&] { context->command_started()(started_event); });
+    }
 }
 
 inline void command_failed(mongoc_apm_command_failed_t const* event) noexcept {
     events::command_failed_event failed_event(static_cast<void const*>(event));
     auto context = static_cast<apm*>(libmongoc::apm_command_failed_get_context(event));
-    exception_guard(__func__, [&] { context->command_failed()(failed_event); });
+
+    // Recorded directly from the libmongoc event rather than through the event wrapper.
+    if (auto const& metrics = context->metrics()) {
+        metrics->record(
+            libmongoc::apm_command_failed_get_command_name(event),
+            libmongoc::apm_command_failed_get_host(event)->host_and_port,
+            libmongoc::apm_command_failed_get_duration(event),
+            true);
+    }
+
+    if (auto const timing = operation_timing::current()) {
+        if (timing->active == operation_timing::k_libmongoc) {
+            timing->record_command(libmongoc::apm_command_failed_get_duration(event));
+        }
+    }
+
+    if (auto const& slow_log = context->slow_log()) {
+        slow_log->finish(failed_event);
+    }
+
+    if (auto const& stats = context->server_stats()) {
+        stats->record(failed_event);
+    }
+
+    if (context->filter() && !context->filter()->accepts(failed_event)) {
+        return;
+    }
+
+    if (auto const& tracer = context->tracer()) {
+        tracer->finish(failed_event);
+    }
+
+    if (auto const& dispatcher = context->dispatcher()) {
+        dispatcher->post(failed_event);
+    }
+
+    if (context->command_failed()) {
+        exception_guard(__func__, [&] { context->command_failed()(failed_event); });
+    }
 }
 
 inline void command_succeeded(mongoc_apm_command_succeeded_t const* event) noexcept {
     events::command_succeeded_event succeeded_event(static_cast<void const*>(event));
     auto context = static_cast<apm*>(libmongoc::apm_command_succeeded_get_context(event));
-    exception_guard(__func__, [&] { context->command_succeeded()(succeeded_event); });
+
+    change_stream_batch::observe(
+        libmongoc::apm_command_succeeded_get_command_name(event), libmongoc::apm_command_succeeded_get_reply(event));
+
+    // Recorded directly from the libmongoc event rather than through the event wrapper.
+    if (auto const& metrics = context->metrics()) {
+        metrics->record(
+            libmongoc::apm_command_succeeded_get_command_name(event),
+            libmongoc::apm_command_succeeded_get_host(event)->host_and_port,
+            libmongoc::apm_command_succeeded_get_duration(event),
+            false);
+    }
+
+    if (auto const timing = operation_timing::current()) {
+        if (timing->active == operation_timing::k_libmongoc) {
+            timing->record_command(libmongoc::apm_command_succeeded_get_duration(event));
+        }
+    }
+
+    if (auto const& slow_log = context->slow_log()) {
+        slow_log->finish(succeeded_event);
+    }
+
+    if (auto const& stats = context->server_stats()) {
+        stats->record(succeeded_event);
+    }
+
+    if (context->filter() && !context->filter()->accepts(succeeded_event)) {
+        return;
+    }
+
+    if (auto const& tracer = context->tracer()) {
+        tracer->finish(succeeded_event);
+    }
+
+    if (auto const& dispatcher = context->dispatcher()) {
+        dispatcher->post(succeeded_event);
+    }
+
+    if (context->command_succeeded()) {
+        exception_guard(__func__, [&] { context->command_succeeded()(succeeded_event); });
+    }
 }
 
 inline void server_closed(mongoc_apm_server_closed_t const* event) noexcept {
@@ -79,13 +191,27 @@ inline void server_opening(mongoc_apm_server_opening_t const* event) noexcept {
 inline void topology_closed(mongoc_apm_topology_closed_t const* event) noexcept {
     events::topology_closed_event e(static_cast<void const*>(event));
     auto context = static_cast<apm*>(libmongoc::apm_topology_closed_get_context(event));
-    exception_guard(__func__, [&] { context->topology_closed()(e); });
+
+    if (auto const& cache = context->cached_topology()) {
+        cache->update(e);
+    }
+
+    if (context->topology_closed()) {
+        exception_guard(__func__, [&] { context->topology_closed()(e); });
+    }
 }
 
 inline void topology_changed(mongoc_apm_topology_changed_t const* event) noexcept {
     events::topology_changed_event e(static_cast<void const*>(event));
     auto context = static_cast<apm*>(libmongoc::apm_topology_changed_get_context(event));
-    exception_guard(__func__, [&] { context->topology_changed()(e); });
+
+    if (auto const& cache = context->cached_topology()) {
+        cache->update(e);
+    }
+
+    if (context->topology_changed()) {
+        exception_guard(__func__, [&] { context->topology_changed()(e); });
+    }
 }
 
 inline void topology_opening(mongoc_apm_topology_opening_t const* event) noexcept {
@@ -103,27 +229,50 @@ inline void heartbeat_started(mongoc_apm_server_heartbeat_started_t const* event
 inline void heartbeat_failed(mongoc_apm_server_heartbeat_failed_t const* event) noexcept {
     events::heartbeat_failed_event failed_event(static_cast<void const*>(event));
     auto context = static_cast<apm*>(libmongoc::apm_server_heartbeat_failed_get_context(event));
-    exception_guard(__func__, [&] { context->heartbeat_failed()(failed_event); });
+
+    if (auto const& stats = context->server_stats()) {
+        stats->record(failed_event);
+    }
+
+    if (context->heartbeat_failed()) {
+        exception_guard(__func__, [&] { context->heartbeat_failed()(failed_event); });
+    }
 }
 
 inline void heartbeat_succeeded(mongoc_apm_server_heartbeat_succeeded_t const* event) noexcept {
     events::heartbeat_succeeded_event succeeded_event(static_cast<void const*>(event));
     auto context = static_cast<apm*>(libmongoc::apm_server_heartbeat_succeeded_get_context(event));
-    exception_guard(__func__, [&] { context->heartbeat_succeeded()(succeeded_event); });
+
+    if (auto const& cache = context->cached_topology()) {
+        cache->update(succeeded_event);
+    }
+
+    if (auto const& stats = context->server_stats()) {
+        stats->record(succeeded_event);
+    }
+
+    if (context->heartbeat_succeeded()) {
+        exception_guard(__func__, [&] { context->heartbeat_succeeded()(succeeded_event); });
+    }
 }
 
 inline apm_unique_callbacks make_apm_callbacks(apm const& apm_opts) {
     mongoc_apm_callbacks_t* callbacks = libmongoc::apm_callbacks_new();
 
-    if (apm_opts.command_started()) {
+    // The filter decides on the started event of a command, which the later events of the command follow.
+    if (apm_opts.command_started() || apm_opts.dispatcher() || apm_opts.filter() || apm_opts.tracer() ||
+        apm_opts.slow_log() || apm_opts.server_stats()) {
         libmongoc::apm_set_command_started_cb(callbacks, command_started);
     }
 
-    if (apm_opts.command_failed()) {
+    if (apm_opts.command_failed() || apm_opts.metrics() || apm_opts.dispatcher() || apm_opts.tracer() ||
+        apm_opts.slow_log() || apm_opts.operation_timing() || apm_opts.server_stats()) {
         libmongoc::apm_set_command_failed_cb(callbacks, command_failed);
     }
 
-    if (apm_opts.command_succeeded()) {
+    if (apm_opts.command_succeeded() || apm_opts.metrics() || apm_opts.dispatcher() || apm_opts.tracer() ||
+        apm_opts.slow_log() || apm_opts.operation_timing() || apm_opts.server_stats() ||
+        apm_opts.change_stream_batches()) {
         libmongoc::apm_set_command_succeeded_cb(callbacks, command_succeeded);
     }
 
@@ -139,11 +288,11 @@ inline apm_unique_callbacks make_apm_callbacks(apm const& apm_opts) {
         libmongoc::apm_set_server_opening_cb(callbacks, server_opening);
     }
 
-    if (apm_opts.topology_closed()) {
+    if (apm_opts.topology_closed() || apm_opts.cached_topology()) {
         libmongoc::apm_set_topology_closed_cb(callbacks, topology_closed);
     }
 
-    if (apm_opts.topology_changed()) {
+    if (apm_opts.topology_changed() || apm_opts.cached_topology()) {
         libmongoc::apm_set_topology_changed_cb(callbacks, topology_changed);
     }
 
@@ -155,11 +304,11 @@ inline apm_unique_callbacks make_apm_callbacks(apm const& apm_opts) {
         libmongoc::apm_set_server_heartbeat_started_cb(callbacks, heartbeat_started);
     }
 
-    if (apm_opts.heartbeat_failed()) {
+    if (apm_opts.heartbeat_failed() || apm_opts.server_stats()) {
         libmongoc::apm_set_server_heartbeat_failed_cb(callbacks, heartbeat_failed);
     }
 
-    if (apm_opts.heartbeat_succeeded()) {
+    if (apm_opts.heartbeat_succeeded() || apm_opts.cached_topology() || apm_opts.server_stats()) {
         libmongoc::apm_set_server_heartbeat_succeeded_cb(callbacks, heartbeat_succeeded);
     }
 
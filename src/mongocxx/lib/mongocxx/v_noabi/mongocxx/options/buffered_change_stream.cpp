@@ -0,0 +1,43 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/options/buffered_change_stream.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace options {
+
+buffered_change_stream::buffered_change_stream() = default;
+
+buffered_change_stream& buffered_change_stream::capacity(std::size_t capacity) {
+    _capacity = capacity;
+    return *this;
+}
+
+bsoncxx::v_noabi::stdx::optional<std::size_t> const& buffered_change_stream::capacity() const {
+    return _capacity;
+}
+
+buffered_change_stream& buffered_change_stream::low_watermark(std::size_t low_watermark) {
+    _low_watermark = low_watermark;
+    return *this;
+}
+
+bsoncxx::v_noabi::stdx::optional<std::size_t> const& buffered_change_stream::low_watermark() const {
+    return _low_watermark;
+}
+
+} // namespace options
+} // namespace v_noabi
+} // namespace mongocxx
@@ -0,0 +1,63 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/options/partitioned_change_stream.hpp>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace options {
+
+partitioned_change_stream::partitioned_change_stream() = default;
+
+partitioned_change_stream& partitioned_change_stream::partitions(std::size_t partitions) {
+    _partitions = partitions;
+    return *this;
+}
+
+bsoncxx::v_noabi::stdx::optional<std::size_t> const& partitioned_change_stream::partitions() const {
+    return _partitions;
+}
+
+partitioned_change_stream& partitioned_change_stream::change_stream_opts(change_stream change_stream_opts) {
+    _change_stream_opts = std::move(change_stream_opts);
+    return *this;
+}
+
+change_stream const& partitioned_change_stream::change_stream_opts() const {
+    return _change_stream_opts;
+}
+
+partitioned_change_stream& partitioned_change_stream::resume_tokens(
+    std::vector<bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>> resume_tokens) {
+    _resume_tokens = std::move(resume_tokens);
+    return *this;
+}
+
+std::vector<bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>> const&
+partitioned_change_stream::resume_tokens() const {
+    return _resume_tokens;
+}
+
+partitioned_change_stream& partitioned_change_stream::max_batch_events(std::size_t max_batch_events) {
+    _max_batch_events = max_batch_events;
+    return *this;
+}
+
+bsoncxx::v_noabi::stdx::optional<std::size_t> const& partitioned_change_stream::max_batch_events() const {
+    return _max_batch_events;
+}
+
+} // namespace options
+} // namespace v_noabi
+} // namespace mongocxx
@@ -0,0 +1,287 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <bsoncxx/array/value.hpp>
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+
+#include <mongocxx/collection.hpp>
+#include <mongocxx/database.hpp>
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+#include <mongocxx/options/change_stream.hpp>
+#include <mongocxx/partitioned_change_stream.hpp>
+#include <mongocxx/pipeline.hpp>
+#include <mongocxx/pool.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+using bsoncxx::v_noabi::builder::basic::kvp;
+using bsoncxx::v_noabi::builder::basic::make_array;
+using bsoncxx::v_noabi::builder::basic::make_document;
+
+namespace mongocxx {
+namespace v_noabi {
+
+namespace {
+
+std::size_t default_partitions() {
+    return (std::max)(std::thread::hardware_concurrency(), 1u);
+}
+
+} // namespace
+
+class partitioned_change_stream::impl {
+   public:
+    using token_type = bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>;
+
+    impl(
+        pool& pool,
+        std::string database,
+        std::string collection,
+        pipeline const& pipe,
+        batch_handler handler,
+        options::partitioned_change_stream const& options)
+        : _pool(pool),
+          _database(std::move(database)),
+          _collection(std::move(collection)),
+          _pipeline(pipe.view_array()),
+          _handler(std::move(handler)),
+          _change_stream_opts(options.change_stream_opts()),
+          _max_batch_events(options.max_batch_events().value_or(0u)),
+          _resume_tokens(options.resume_tokens()),
+          _stopping(false) {
+        auto const partitions = options.partitions().value_or(default_partitions());
+
+        if (partitions == 0u) {
+            throw logic_error{error_code::k_invalid_parameter};
+        }
+
+        if (_resume_tokens.empty()) {
+            _resume_tokens.resize(partitions);
+        } else if (_resume_tokens.size() != partitions) {
+            throw logic_error{error_code::k_invalid_parameter};
+        }
+    }
+
+    ~impl() {
+        join();
+    }
+
+    impl(impl&&) = delete;
+    impl& operator=(impl&&) = delete;
+
+    impl(impl const&) = delete;
+    impl& operator=(impl const&) = delete;
+
+    void start() {
+        if (!_workers.empty()) {
+            throw logic_error{error_code::k_invalid_parameter};
+        }
+
+        _stopping.store(false);
+        _error = nullptr;
+
+        // Each partition holds a client for as long as it runs. Acquire them all up front rather than
+        // letting the workers block forever on a pool which cannot supply one per partition.
+        for (std::size_t partition = 0u; partition < _resume_tokens.size(); ++partition) {
+            auto client = _pool.try_acquire();
+
+            if (!client) {
+                _clients.clear();
+                throw logic_error{
+                    error_code::k_invalid_parameter,
+                    "the pool has fewer available clients than the partitioned change stream has partitions"};
+            }
+
+            _clients.push_back(std::move(*client));
+        }
+
+        try {
+            for (std::size_t partition = 0u; partition < _resume_tokens.size(); ++partition) {
+                _workers.emplace_back([this, partition] { this->run(partition); });
+            }
+        } catch (...) {
+            join();
+            throw;
+        }
+    }
+
+    void stop() {
+        join();
+
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            std::swap(error, _error);
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::size_t partitions() const noexcept {
+        return _resume_tokens.size();
+    }
+
+    std::vector<token_type> resume_tokens() const {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _resume_tokens;
+    }
+
+   private:
+    void join() {
+        _stopping.store(true);
+
+        for (auto& worker : _workers) {
+            worker.join();
+        }
+
+        _workers.clear();
+        _clients.clear();
+    }
+
+    void run(std::size_t partition) {
+        try {
+            auto coll = (*_clients[partition])[_database][_collection];
+
+            pipeline pipe;
+            pipe.match(partitioned_change_stream::partition_filter(partition, _resume_tokens.size()));
+            pipe.append_stages(_pipeline.view());
+
+            // Keep the token alive until the stream has been opened: the options only hold a view.
+            token_type token;
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                token = _resume_tokens[partition];
+            }
+
+            auto opts = _change_stream_opts;
+            if (token) {
+                opts.resume_after(token->view());
+            }
+
+            auto const stream = coll.watch(pipe, opts);
+
+            while (!_stopping.load()) {
+                auto const batch = stream.next_batch(_max_batch_events);
+
+                if (!batch.empty()) {
+                    _handler(partition, batch);
+                }
+
+                // Only checkpoint once the handler has processed the whole batch.
+                if (auto const resume_token = batch.resume_token()) {
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    _resume_tokens[partition] = bsoncxx::v_noabi::document::value{*resume_token};
+                }
+            }
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                if (!_error) {
+                    _error = std::current_exception();
+                }
+            }
+
+            // Stop every partition: consumers rely on all partitions being covered.
+            _stopping.store(true);
+        }
+    }
+
+    pool& _pool;
+    std::string const _database;
+    std::string const _collection;
+    bsoncxx::v_noabi::array::value const _pipeline;
+    batch_handler const _handler;
+    options::change_stream const _change_stream_opts;
+    std::size_t const _max_batch_events;
+
+    mutable std::mutex _mutex;
+    std::vector<token_type> _resume_tokens; // Guarded by _mutex.
+    std::exception_ptr _error;              // Guarded by _mutex.
+
+    std::atomic<bool> _stopping;
+    std::vector<pool::entry> _clients;
+    std::vector<std::thread> _workers;
+};
+
+partitioned_change_stream::partitioned_change_stream(
+    pool& pool,
+    bsoncxx::v_noabi::string::view_or_value database,
+    bsoncxx::v_noabi::string::view_or_value collection,
+    pipeline const& pipe,
+    batch_handler handler,
+    options::partitioned_change_stream const& options)
+    : _impl(bsoncxx::make_unique<impl>(
+          pool,
+          std::string{database.view()},
+          std::string{collection.view()},
+          pipe,
+          std::move(handler),
+          options)) {}
+
+partitioned_change_stream::~partitioned_change_stream() = default;
+
+partitioned_change_stream::partitioned_change_stream(partitioned_change_stream&&) noexcept = default;
+partitioned_change_stream& partitioned_change_stream::operator=(partitioned_change_stream&&) noexcept = default;
+
+void partitioned_change_stream::start() {
+    _impl->start();
+}
+
+void partitioned_change_stream::stop() {
+    _impl->stop();
+}
+
+std::size_t partitioned_change_stream::partitions() const noexcept {
+    return _impl->partitions();
+}
+
+std::vector<bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value>>
+partitioned_change_stream::resume_tokens() const {
+    return _impl->resume_tokens();
+}
+
+bsoncxx::v_noabi::document::value partitioned_change_stream::partition_filter(
+    std::size_t partition,
+    std::size_t partitions) {
+    // Notifications without a documentKey (e.g. drop, invalidate) apply to every partition.
+    // Otherwise, $toHashedIndexKey uses the same hash as hashed indexes, which is stable across
+    // servers and restarts, so a document is always assigned to the same partition.
+    auto const hash = make_document(kvp("$toHashedIndexKey", "$documentKey._id"));
+    auto const modulo = make_document(kvp("$mod", make_array(hash.view(), static_cast<std::int64_t>(partitions))));
+    auto const bucket = make_document(kvp("$abs", modulo.view()));
+    auto const expr = make_document(kvp("$eq", make_array(bucket.view(), static_cast<std::int64_t>(partition))));
+
+    return make_document(kvp(
+        "$or",
+        make_array(
+            make_document(kvp("documentKey", make_document(kvp("$exists", false)))),
+            make_document(kvp("$expr", expr.view())))));
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
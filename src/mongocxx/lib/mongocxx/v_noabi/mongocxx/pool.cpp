@@ -48,6 +48,8 @@ static mongoc_client_pool_t* construct_client_pool(mongoc_uri_t* uri) {
 }
 
 void pool::_release(client* client) {
+    // The cached handles refer to the mongoc_client_t, which another thread may acquire once pushed.
+    client->_get_impl().handles.clear();
     libmongoc::client_pool_push(_impl->client_pool_t, client->_get_impl().client_t);
     // prevent client destructor from destroying the underlying mongoc_client_t
     client->_get_impl().client_t = nullptr;
@@ -0,0 +1,341 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/server_statistics.hpp>
+
+//
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+#include <bsoncxx/private/make_unique.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+
+namespace {
+
+using bsoncxx::v_noabi::stdx::string_view;
+
+// The statistics of a server. Counters may be written by several threads at once.
+struct entry {
+    entry(string_view host, std::uint16_t port)
+        : host{host},
+          port{port},
+          rtt{-1},
+          rtt_count{0u},
+          heartbeats_succeeded{0u},
+          heartbeats_failed{0u},
+          consecutive_heartbeat_failures{0u},
+          in_flight{0},
+          succeeded{0u},
+          failed{0u},
+          bytes_sent{0u},
+          bytes_received{0u},
+          duration_count{0u},
+          next{nullptr} {
+        for (auto& duration : durations) {
+            duration.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    entry(entry const&) = delete;
+    entry& operator=(entry const&) = delete;
+
+    bool is(string_view h, std::uint16_t p) const {
+        return port == p && string_view{host} == h;
+    }
+
+    std::string const host;
+    std::uint16_t const port;
+
+    // Heartbeats are infrequent, so their round-trip times are simply guarded by a mutex.
+    mutable std::mutex rtt_mutex;
+    std::int64_t rtt;
+    std::uint64_t rtt_count;
+    std::array<std::int64_t, server_statistics::k_rtt_samples> rtts;
+
+    std::atomic<std::uint64_t> heartbeats_succeeded;
+    std::atomic<std::uint64_t> heartbeats_failed;
+    std::atomic<std::uint64_t> consecutive_heartbeat_failures;
+
+    std::atomic<std::int64_t> in_flight;
+    std::atomic<std::uint64_t> succeeded;
+    std::atomic<std::uint64_t> failed;
+    std::atomic<std::uint64_t> bytes_sent;
+    std::atomic<std::uint64_t> bytes_received;
+
+    // A ring of the most recent command durations, in microseconds.
+    std::atomic<std::uint64_t> duration_count;
+    std::array<std::atomic<std::int64_t>, server_statistics::k_duration_samples> durations;
+
+    // Immutable once the entry is published.
+    entry* next;
+};
+
+// Nearest-rank percentiles of the given samples, which are reordered.
+server_statistics::percentiles compute_percentiles(std::int64_t* first, std::size_t n) {
+    server_statistics::percentiles ret{n, {}, {}, {}};
+
+    if (n == 0u) {
+        return ret;
+    }
+
+    std::sort(first, first + n);
+
+    auto const rank = [&](std::size_t percent) {
+        return std::chrono::microseconds{first[(percent * n + 99u) / 100u - 1u]};
+    };
+
+    ret.p50 = rank(50u);
+    ret.p90 = rank(90u);
+    ret.p99 = rank(99u);
+
+    return ret;
+}
+
+} // namespace
+
+class server_statistics::impl {
+   public:
+    impl() : _entries{nullptr} {}
+
+    ~impl() {
+        entry* e = _entries.load(std::memory_order_relaxed);
+
+        while (e) {
+            entry* const next = e->next;
+            delete e;
+            e = next;
+        }
+    }
+
+    impl(impl&&) = delete;
+    impl& operator=(impl&&) = delete;
+
+    impl(impl const&) = delete;
+    impl& operator=(impl const&) = delete;
+
+    void started(string_view host, std::uint16_t port, std::size_t size) {
+        entry& e = lookup(host, port);
+
+        e.in_flight.fetch_add(1, std::memory_order_relaxed);
+        e.bytes_sent.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    void finished(string_view host, std::uint16_t port, std::int64_t duration, std::size_t size, bool failed) {
+        entry& e = lookup(host, port);
+
+        e.in_flight.fetch_sub(1, std::memory_order_relaxed);
+        (failed ? e.failed : e.succeeded).fetch_add(1u, std::memory_order_relaxed);
+        e.bytes_received.fetch_add(size, std::memory_order_relaxed);
+
+        std::uint64_t const index = e.duration_count.fetch_add(1u, std::memory_order_relaxed);
+        e.durations[index % k_duration_samples].store(duration, std::memory_order_relaxed);
+    }
+
+    void heartbeat_succeeded(string_view host, std::uint16_t port, std::int64_t duration, bool awaited) {
+        entry& e = lookup(host, port);
+
+        e.heartbeats_succeeded.fetch_add(1u, std::memory_order_relaxed);
+        e.consecutive_heartbeat_failures.store(0u, std::memory_order_relaxed);
+
+        // The duration of an awaited heartbeat includes the time the server waited before replying.
+        if (awaited) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock{e.rtt_mutex};
+
+        e.rtt = e.rtt < 0 ? duration : (duration + 4 * e.rtt) / 5;
+        e.rtts[e.rtt_count++ % k_rtt_samples] = duration;
+    }
+
+    void heartbeat_failed(string_view host, std::uint16_t port) {
+        entry& e = lookup(host, port);
+
+        e.heartbeats_failed.fetch_add(1u, std::memory_order_relaxed);
+        e.consecutive_heartbeat_failures.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    std::vector<server> servers() const {
+        std::vector<server> ret;
+
+        for (entry const* e = _entries.load(std::memory_order_acquire); e; e = e->next) {
+            ret.push_back(statistics(*e));
+        }
+
+        std::sort(ret.begin(), ret.end(), [](server const& lhs, server const& rhs) {
+            int const cmp = lhs.host.compare(rhs.host);
+            return cmp < 0 || (cmp == 0 && lhs.port < rhs.port);
+        });
+
+        return ret;
+    }
+
+    bsoncxx::v_noabi::stdx::optional<server> find(string_view host, std::uint16_t port) const {
+        if (entry const* e = find(_entries.load(std::memory_order_acquire), nullptr, host, port)) {
+            return statistics(*e);
+        }
+
+        return {};
+    }
+
+   private:
+    static entry* find(entry* first, entry* last, string_view host, std::uint16_t port) {
+        for (entry* e = first; e != last; e = e->next) {
+            if (e->is(host, port)) {
+                return e;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Entries are published by prepending them to a list which is traversed without locking.
+    entry& lookup(string_view host, std::uint16_t port) {
+        entry* const head = _entries.load(std::memory_order_acquire);
+
+        if (entry* const found = find(head, nullptr, host, port)) {
+            return *found;
+        }
+
+        std::unique_ptr<entry> added{new entry{host, port}};
+        entry* searched = head;
+
+        added->next = head;
+
+        while (!_entries.compare_exchange_weak(
+            added->next, added.get(), std::memory_order_release, std::memory_order_acquire)) {
+            // Another thread may have added the same server meanwhile.
+            if (entry* const found = find(added->next, searched, host, port)) {
+                return *found;
+            }
+
+            searched = added->next;
+        }
+
+        return *added.release();
+    }
+
+    static server statistics(entry const& e) {
+        server ret;
+
+        ret.host = e.host;
+        ret.port = e.port;
+
+        {
+            std::array<std::int64_t, k_rtt_samples> rtts;
+            std::size_t count;
+
+            {
+                std::lock_guard<std::mutex> lock{e.rtt_mutex};
+
+                ret.round_trip_time = std::chrono::microseconds{e.rtt};
+                count = static_cast<std::size_t>(std::min<std::uint64_t>(e.rtt_count, k_rtt_samples));
+                rtts = e.rtts;
+            }
+
+            ret.round_trip_times = compute_percentiles(rtts.data(), count);
+        }
+
+        ret.heartbeats_succeeded = e.heartbeats_succeeded.load(std::memory_order_relaxed);
+        ret.heartbeats_failed = e.heartbeats_failed.load(std::memory_order_relaxed);
+        ret.consecutive_heartbeat_failures = e.consecutive_heartbeat_failures.load(std::memory_order_relaxed);
+        ret.commands_in_flight = e.in_flight.load(std::memory_order_relaxed);
+        ret.commands_succeeded = e.succeeded.load(std::memory_order_relaxed);
+        ret.commands_failed = e.failed.load(std::memory_order_relaxed);
+        ret.bytes_sent = e.bytes_sent.load(std::memory_order_relaxed);
+        ret.bytes_received = e.bytes_received.load(std::memory_order_relaxed);
+
+        {
+            std::array<std::int64_t, k_duration_samples> durations;
+            std::size_t const count = static_cast<std::size_t>(
+                std::min<std::uint64_t>(e.duration_count.load(std::memory_order_relaxed), k_duration_samples));
+
+            for (std::size_t i = 0; i < count; ++i) {
+                durations[i] = e.durations[i].load(std::memory_order_relaxed);
+            }
+
+            ret.command_durations = compute_percentiles(durations.data(), count);
+        }
+
+        return ret;
+    }
+
+    std::atomic<entry*> _entries;
+};
+
+constexpr std::size_t server_statistics::k_rtt_samples;
+constexpr std::size_t server_statistics::k_duration_samples;
+
+server_statistics::server_statistics() : _impl{bsoncxx::make_unique<impl>()} {}
+
+server_statistics::~server_statistics() = default;
+
+void server_statistics::record(events::command_started_event const& event) noexcept {
+    try {
+        _impl->started(event.host(), event.port(), event.command().length());
+    } catch (...) {
+        // The statistics are diagnostic: drop the recording rather than fail the command.
+    }
+}
+
+void server_statistics::record(events::command_succeeded_event const& event) noexcept {
+    try {
+        _impl->finished(event.host(), event.port(), event.duration(), event.reply().length(), false);
+    } catch (...) {
+        // Drop the recording.
+    }
+}
+
+void server_statistics::record(events::command_failed_event const& event) noexcept {
+    try {
+        _impl->finished(event.host(), event.port(), event.duration(), event.failure().length(), true);
+    } catch (...) {
+        // Drop the recording.
+    }
+}
+
+void server_statistics::record(events::heartbeat_succeeded_event const& event) noexcept {
+    try {
+        _impl->heartbeat_succeeded(event.host(), event.port(), event.duration(), event.awaited());
+    } catch (...) {
+        // Drop the recording.
+    }
+}
+
+void server_statistics::record(events::heartbeat_failed_event const& event) noexcept {
+    try {
+        _impl->heartbeat_failed(event.host(), event.port());
+    } catch (...) {
+        // Drop the recording.
+    }
+}
+
+std::vector<server_statistics::server> server_statistics::servers() const {
+    return _impl->servers();
+}
+
+bsoncxx::v_noabi::stdx::optional<server_statistics::server> server_statistics::find(
+    bsoncxx::v_noabi::stdx::string_view host,
+    std::uint16_t port) const {
+    return _impl->find(host, port);
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
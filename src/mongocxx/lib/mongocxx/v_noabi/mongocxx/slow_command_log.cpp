@@ -0,0 +1,382 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/slow_command_log.hpp>
+
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+#include <bsoncxx/array/element.hpp>
+#include <bsoncxx/array/view.hpp>
+#include <bsoncxx/builder/core.hpp>
+#include <bsoncxx/document/element.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/stdx/optional.hpp>
+#include <bsoncxx/stdx/string_view.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+#include <mongocxx/private/command_collection.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+
+namespace {
+
+using bsoncxx::v_noabi::builder::core;
+
+// Commands up to this size are copied when they start and shaped only if they turn out to be slow.
+// Larger commands, e.g. bulk inserts, are shaped when they start instead.
+constexpr std::size_t k_max_copied_command = 16 * 1024;
+
+// Documents and arrays nested deeper than this are replaced by the name of their type.
+constexpr int k_max_shape_depth = 8;
+
+// The fields added to every command by the driver, which say nothing of the command itself.
+char const* const k_driver_fields[] = {
+    "lsid",
+    "txnNumber",
+    "$db",
+    "$clusterTime",
+    "$readPreference",
+    "apiVersion",
+    "apiStrict",
+    "apiDeprecationErrors",
+};
+
+bool is_driver_field(bsoncxx::v_noabi::stdx::string_view key) {
+    for (auto const field : k_driver_fields) {
+        if (key == field) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void assign(std::string& out, bsoncxx::v_noabi::stdx::string_view value) {
+    out.assign(value.data(), value.size());
+}
+
+// Element is either a document::element or an array::element.
+template <typename Element>
+void append_shape(core& builder, Element const& element, int depth) {
+    switch (element.type()) {
+        case bsoncxx::v_noabi::type::k_document: {
+            if (depth >= k_max_shape_depth) {
+                break;
+            }
+
+            builder.open_document();
+            for (auto const& field : element.get_document().value) {
+                builder.key_view(field.key());
+                append_shape(builder, field, depth + 1);
+            }
+            builder.close_document();
+            return;
+        }
+
+        case bsoncxx::v_noabi::type::k_array: {
+            if (depth >= k_max_shape_depth) {
+                break;
+            }
+
+            // The elements of an array usually share a shape: keep the first one only.
+            auto const array = element.get_array().value;
+            auto first = array.begin();
+
+            builder.open_array();
+            if (first != array.end()) {
+                append_shape(builder, *first, depth + 1);
+            }
+            builder.close_array();
+            return;
+        }
+
+        default:
+            break;
+    }
+
+    builder.append(bsoncxx::v_noabi::to_string(element.type()));
+}
+
+bsoncxx::v_noabi::document::value make_shape(bsoncxx::v_noabi::document::view command) {
+    core builder{false};
+
+    for (auto const& field : command) {
+        if (is_driver_field(field.key())) {
+            continue;
+        }
+
+        builder.key_view(field.key());
+        append_shape(builder, field, 1);
+    }
+
+    return builder.extract_document();
+}
+
+// The command started by this thread and not yet finished. The events of a command are published
+// by the thread running the command with no other command in between.
+struct pending_command {
+    void const* owner;
+    std::int64_t request_id;
+    std::int64_t operation_id;
+    std::string command_name;
+    std::string database_name;
+    std::string collection_name;
+    std::chrono::system_clock::time_point start_time;
+
+    // The command, if it is small enough to be copied.
+    std::vector<std::uint8_t> command;
+
+    // The shape of the command, if it is too large to be copied.
+    bsoncxx::v_noabi::stdx::optional<bsoncxx::v_noabi::document::value> shape;
+};
+
+thread_local pending_command pending = {};
+
+// Orders entries such that the fastest of a window is at the front of its heap.
+bool slower(slow_command_log::entry const& lhs, slow_command_log::entry const& rhs) {
+    return lhs.duration > rhs.duration;
+}
+
+} // namespace
+
+class slow_command_log::impl {
+   public:
+    impl(std::chrono::microseconds threshold, std::size_t top_k, std::chrono::seconds window)
+        : _threshold{threshold},
+          _top_k{top_k},
+          _window{std::chrono::duration_cast<std::chrono::steady_clock::duration>(window)},
+          _window_start{std::chrono::steady_clock::now()},
+          _slow_count{0} {}
+
+    void start(events::command_started_event const& event) {
+        pending_command& p = pending;
+
+        p.owner = nullptr;
+
+        auto const command = event.command();
+
+        p.request_id = event.request_id();
+        p.operation_id = event.operation_id();
+        assign(p.command_name, event.command_name());
+        assign(p.database_name, event.database_name());
+        assign(p.collection_name, command_collection_name(event.command_name(), command));
+        p.start_time = std::chrono::system_clock::now();
+
+        if (command.length() <= k_max_copied_command) {
+            p.command.assign(command.data(), command.data() + command.length());
+            p.shape = {};
+        } else {
+            p.command.clear();
+            p.shape = make_shape(command);
+        }
+
+        p.owner = this;
+    }
+
+    void finish(
+        std::int64_t request_id,
+        std::int64_t duration,
+        bsoncxx::v_noabi::stdx::string_view host,
+        std::uint16_t port,
+        std::size_t reply_size,
+        bool failed) {
+        pending_command& p = pending;
+
+        if (p.owner != this || p.request_id != request_id) {
+            return;
+        }
+
+        p.owner = nullptr;
+
+        std::chrono::microseconds const elapsed{duration};
+
+        if (elapsed < _threshold) {
+            return;
+        }
+
+        _slow_count.fetch_add(1, std::memory_order_relaxed);
+
+        // Slow commands are rare by definition: the lock is not contended by the fast path.
+        std::lock_guard<std::mutex> lock{_mutex};
+
+        roll(std::chrono::steady_clock::now());
+
+        if (_current.size() == _top_k && elapsed <= _current.front().duration) {
+            return;
+        }
+
+        entry e{
+            p.command_name,
+            p.database_name,
+            p.collection_name,
+            std::string{host.data(), host.size()},
+            port,
+            p.shape ? std::move(*p.shape)
+                    : make_shape(bsoncxx::v_noabi::document::view{p.command.data(), p.command.size()}),
+            p.start_time,
+            elapsed,
+            reply_size,
+            failed,
+            p.request_id,
+            p.operation_id};
+
+        if (_current.size() == _top_k) {
+            std::pop_heap(_current.begin(), _current.end(), slower);
+            _current.back() = std::move(e);
+        } else {
+            _current.push_back(std::move(e));
+        }
+
+        std::push_heap(_current.begin(), _current.end(), slower);
+    }
+
+    std::vector<entry> slowest() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        roll(std::chrono::steady_clock::now());
+        return sorted(_current);
+    }
+
+    std::vector<entry> previous_slowest() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        roll(std::chrono::steady_clock::now());
+        return sorted(_previous);
+    }
+
+    std::uint64_t slow_count() const noexcept {
+        return _slow_count.load(std::memory_order_relaxed);
+    }
+
+    std::chrono::microseconds threshold() const noexcept {
+        return _threshold;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _current.clear();
+        _previous.clear();
+        _slow_count.store(0, std::memory_order_relaxed);
+    }
+
+   private:
+    // Starts a new window if the current one has elapsed. The current window becomes the previous
+    // one only if no complete window elapsed since.
+    void roll(std::chrono::steady_clock::time_point now) {
+        if (now - _window_start < _window) {
+            return;
+        }
+
+        auto const windows = (now - _window_start) / _window;
+
+        if (windows == 1) {
+            _previous = std::move(_current);
+        } else {
+            _previous.clear();
+        }
+
+        _current.clear();
+        _window_start += windows * _window;
+    }
+
+    static std::vector<entry> sorted(std::vector<entry> const& entries) {
+        std::vector<entry> ret{entries};
+        std::sort(ret.begin(), ret.end(), slower);
+        return ret;
+    }
+
+    std::chrono::microseconds const _threshold;
+    std::size_t const _top_k;
+    std::chrono::steady_clock::duration const _window;
+
+    std::mutex _mutex;
+    std::chrono::steady_clock::time_point _window_start;
+    std::vector<entry> _current;  // A min-heap on duration.
+    std::vector<entry> _previous; // A min-heap on duration.
+
+    std::atomic<std::uint64_t> _slow_count;
+};
+
+slow_command_log::slow_command_log(
+    std::chrono::microseconds threshold,
+    std::size_t top_k,
+    std::chrono::seconds window) {
+    if (threshold.count() < 0 || top_k == 0 || window.count() <= 0) {
+        throw logic_error{error_code::k_invalid_parameter};
+    }
+
+    _impl = bsoncxx::make_unique<impl>(threshold, top_k, window);
+}
+
+slow_command_log::~slow_command_log() = default;
+
+void slow_command_log::start(events::command_started_event const& event) noexcept {
+    try {
+        _impl->start(event);
+    } catch (...) {
+        // The log is diagnostic: forget the command rather than fail it.
+        pending.owner = nullptr;
+    }
+}
+
+void slow_command_log::finish(events::command_succeeded_event const& event) noexcept {
+    try {
+        _impl->finish(
+            event.request_id(), event.duration(), event.host(), event.port(), event.reply().length(), false);
+    } catch (...) {
+        pending.owner = nullptr;
+    }
+}
+
+void slow_command_log::finish(events::command_failed_event const& event) noexcept {
+    try {
+        _impl->finish(
+            event.request_id(), event.duration(), event.host(), event.port(), event.failure().length(), true);
+    } catch (...) {
+        pending.owner = nullptr;
+    }
+}
+
+std::vector<slow_command_log::entry> slow_command_log::slowest() const {
+    return _impl->slowest();
+}
+
+std::vector<slow_command_log::entry> slow_command_log::previous_slowest() const {
+    return _impl->previous_slowest();
+}
+
+std::uint64_t slow_command_log::slow_count() const noexcept {
+    return _impl->slow_count();
+}
+
+std::chrono::microseconds slow_command_log::threshold() const noexcept {
+    return _impl->threshold();
+}
+
+void slow_command_log::clear() {
+    _impl->clear();
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
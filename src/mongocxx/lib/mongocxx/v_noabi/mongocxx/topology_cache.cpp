@@ -0,0 +1,315 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/topology_cache.hpp>
+
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include <bsoncxx/document/element.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <mongocxx/events/server_description.hpp>
+#include <mongocxx/events/topology_description.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+
+struct topology_cache::state {
+    std::uint64_t version = 0u;
+    std::string type = "Unknown";
+    bool writable = false;
+    std::vector<server> servers; // Ordered by host and port.
+
+    // The number of snapshots holding this state.
+    mutable std::atomic<std::size_t> refs{0u};
+};
+
+namespace {
+
+bool before(topology_cache::server const& lhs, bsoncxx::v_noabi::stdx::string_view host, std::uint16_t port) {
+    int const cmp = bsoncxx::v_noabi::stdx::string_view{lhs.host}.compare(host);
+    return cmp < 0 || (cmp == 0 && lhs.port < port);
+}
+
+bool is_writable(bsoncxx::v_noabi::stdx::string_view type) {
+    return type == "RSPrimary" || type == "Mongos" || type == "Standalone" || type == "LoadBalancer";
+}
+
+// libmongoc reports the round-trip time of a server description in milliseconds, while heartbeat
+// durations are in microseconds.
+std::int64_t to_microseconds(std::int64_t round_trip_time_ms) {
+    return round_trip_time_ms < 0 ? -1 : round_trip_time_ms * 1000;
+}
+
+void append_tags(std::vector<std::pair<std::string, std::string>>& out, bsoncxx::v_noabi::document::view hello) {
+    auto const tags = hello["tags"];
+
+    if (!tags || tags.type() != bsoncxx::v_noabi::type::k_document) {
+        return;
+    }
+
+    for (auto const& tag : tags.get_document().value) {
+        if (tag.type() == bsoncxx::v_noabi::type::k_string) {
+            out.emplace_back(std::string{tag.key()}, std::string{tag.get_string().value});
+        }
+    }
+}
+
+} // namespace
+
+class topology_cache::impl {
+   private:
+    using state_ptr = std::unique_ptr<state>;
+
+   public:
+    impl() : _current{new state{}}, _readers{0u} {}
+
+    ~impl() {
+        // Snapshots must not outlive the cache, so that every state may be freed regardless of its pins.
+        delete _current.load();
+
+        for (auto const s : _retired) {
+            delete s;
+        }
+    }
+
+    impl(impl&&) = delete;
+    impl& operator=(impl&&) = delete;
+
+    impl(impl const&) = delete;
+    impl& operator=(impl const&) = delete;
+
+    // A writer only frees a retired state after observing no reader between loading the current
+    // state and pinning it. A reader which starts later loads a state which is not retired yet.
+    state const* acquire() const noexcept {
+        _readers.fetch_add(1u);
+        state const* const s = _current.load();
+        s->refs.fetch_add(1u, std::memory_order_relaxed);
+        _readers.fetch_sub(1u);
+        return s;
+    }
+
+    static void release(state const* s) noexcept {
+        s->refs.fetch_sub(1u, std::memory_order_release);
+    }
+
+    void changed(events::topology_description const& description) {
+        state_ptr next{new state{}};
+
+        next->type = std::string{description.type()};
+
+        for (auto const& sd : description.servers()) {
+            server entry;
+
+            entry.id = sd.id();
+            entry.host = std::string{sd.host()};
+            entry.port = sd.port();
+            entry.type = std::string{sd.type()};
+            entry.round_trip_time = to_microseconds(sd.round_trip_time());
+            append_tags(entry.tags, sd.hello());
+
+            next->writable = next->writable || is_writable(entry.type);
+            next->servers.push_back(std::move(entry));
+        }
+
+        std::sort(next->servers.begin(), next->servers.end(), [](server const& lhs, server const& rhs) {
+            return before(lhs, rhs.host, rhs.port);
+        });
+
+        std::lock_guard<std::mutex> lock{_mutex};
+        publish(std::move(next));
+    }
+
+    void closed() {
+        state_ptr next{new state{}};
+
+        std::lock_guard<std::mutex> lock{_mutex};
+        publish(std::move(next));
+    }
+
+    void heartbeat(bsoncxx::v_noabi::stdx::string_view host, std::uint16_t port, std::int64_t duration) {
+        std::lock_guard<std::mutex> lock{_mutex};
+
+        // Only writers replace the current state, so it cannot be retired while the lock is held.
+        state const& current = *_current.load();
+
+        auto const it = find(current.servers, host, port);
+
+        if (it == current.servers.end()) {
+            return;
+        }
+
+        // An exponentially weighted moving average with a weighting factor of 0.2, as in the server
+        // discovery and monitoring specification.
+        std::int64_t const rtt = it->round_trip_time < 0 ? duration : (duration + 4 * it->round_trip_time) / 5;
+
+        if (rtt == it->round_trip_time) {
+            return;
+        }
+
+        state_ptr next{new state{}};
+
+        next->type = current.type;
+        next->writable = current.writable;
+        next->servers = current.servers;
+        next->servers[static_cast<std::size_t>(it - current.servers.begin())].round_trip_time = rtt;
+
+        publish(std::move(next));
+    }
+
+    static std::vector<server>::const_iterator
+    find(std::vector<server> const& servers, bsoncxx::v_noabi::stdx::string_view host, std::uint16_t port) {
+        auto const it = std::lower_bound(
+            servers.begin(), servers.end(), host, [port](server const& s, bsoncxx::v_noabi::stdx::string_view h) {
+                return before(s, h, port);
+            });
+
+        if (it == servers.end() || bsoncxx::v_noabi::stdx::string_view{it->host} != host || it->port != port) {
+            return servers.end();
+        }
+
+        return it;
+    }
+
+   private:
+    // Requires the lock to be held.
+    void publish(state_ptr next) {
+        // Reserved beforehand so that retiring the previous state cannot fail once it is replaced.
+        _retired.reserve(_retired.size() + 1u);
+
+        next->version = _current.load()->version + 1u;
+
+        _retired.push_back(_current.exchange(next.release()));
+
+        reclaim();
+    }
+
+    // Requires the lock to be held.
+    void reclaim() {
+        if (_readers.load() != 0u) {
+            return;
+        }
+
+        auto const unpinned = std::partition(_retired.begin(), _retired.end(), [](state const* s) {
+            return s->refs.load(std::memory_order_acquire) != 0u;
+        });
+
+        for (auto it = unpinned; it != _retired.end(); ++it) {
+            delete *it;
+        }
+
+        _retired.erase(unpinned, _retired.end());
+    }
+
+    std::mutex _mutex;
+    std::atomic<state const*> _current;
+    mutable std::atomic<std::size_t> _readers;
+    std::vector<state const*> _retired; // Guarded by _mutex.
+};
+
+topology_cache::snapshot::snapshot(snapshot&& other) noexcept : _state{other._state} {
+    other._state = nullptr;
+}
+
+topology_cache::snapshot& topology_cache::snapshot::operator=(snapshot&& other) noexcept {
+    if (this != &other) {
+        if (_state) {
+            impl::release(_state);
+        }
+
+        _state = other._state;
+        other._state = nullptr;
+    }
+
+    return *this;
+}
+
+topology_cache::snapshot::~snapshot() {
+    if (_state) {
+        impl::release(_state);
+    }
+}
+
+std::uint64_t topology_cache::snapshot::version() const noexcept {
+    return _state->version;
+}
+
+std::string const& topology_cache::snapshot::type() const noexcept {
+    return _state->type;
+}
+
+bool topology_cache::snapshot::has_writable_server() const noexcept {
+    return _state->writable;
+}
+
+std::vector<topology_cache::server> const& topology_cache::snapshot::servers() const noexcept {
+    return _state->servers;
+}
+
+topology_cache::server const* topology_cache::snapshot::find(
+    bsoncxx::v_noabi::stdx::string_view host,
+    std::uint16_t port) const noexcept {
+    auto const it = impl::find(_state->servers, host, port);
+    return it == _state->servers.end() ? nullptr : &*it;
+}
+
+topology_cache::snapshot::snapshot(state const* s) noexcept : _state{s} {}
+
+topology_cache::topology_cache() : _impl{bsoncxx::make_unique<impl>()} {}
+
+topology_cache::~topology_cache() = default;
+
+topology_cache::snapshot topology_cache::current() const noexcept {
+    return snapshot{_impl->acquire()};
+}
+
+void topology_cache::update(events::topology_changed_event const& event) noexcept {
+    try {
+        _impl->changed(event.new_description());
+    } catch (...) {
+        // Keep the previous snapshot rather than fail the monitoring thread.
+    }
+}
+
+void topology_cache::update(events::topology_closed_event const&) noexcept {
+    try {
+        _impl->closed();
+    } catch (...) {
+        // Keep the previous snapshot.
+    }
+}
+
+void topology_cache::update(events::heartbeat_succeeded_event const& event) noexcept {
+    if (event.awaited()) {
+        // The duration of an awaited heartbeat includes the time the server waited before replying.
+        return;
+    }
+
+    try {
+        _impl->heartbeat(event.host(), event.port(), event.duration());
+    } catch (...) {
+        // Keep the previous round-trip time.
+    }
+}
+
+} // namespace v_noabi
+} // namespace mongocxx
@@ -0,0 +1,122 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/tracing/file_exporter.hpp>
+
+//
+
+#include <fstream>
+#include <mutex>
+#include <string>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/json.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace tracing {
+
+namespace {
+
+using bsoncxx::v_noabi::builder::basic::kvp;
+
+bsoncxx::v_noabi::document::value to_document(span const& s) {
+    bsoncxx::v_noabi::builder::basic::document doc;
+
+    doc.append(kvp("command_name", s.command_name));
+
+    if (!s.database_name.empty()) {
+        doc.append(kvp("database_name", s.database_name));
+    }
+
+    if (!s.collection_name.empty()) {
+        doc.append(kvp("collection_name", s.collection_name));
+    }
+
+    doc.append(kvp("host", s.host), kvp("port", static_cast<std::int32_t>(s.port)));
+
+    if (s.service_id) {
+        doc.append(kvp("service_id", *s.service_id));
+    }
+
+    doc.append(
+        kvp("request_id", s.request_id),
+        kvp("operation_id", s.operation_id),
+        kvp("attempt", static_cast<std::int64_t>(s.attempt)),
+        kvp("start_time", bsoncxx::v_noabi::types::b_date{s.start_time}),
+        kvp("duration_us", static_cast<std::int64_t>(s.duration.count())),
+        kvp("failed", s.failed));
+
+    if (!s.error_message.empty()) {
+        doc.append(kvp("error_message", s.error_message));
+    }
+
+    return doc.extract();
+}
+
+} // namespace
+
+class file_exporter::impl {
+   public:
+    explicit impl(std::string const& path) : _file{path, std::ios::out | std::ios::app | std::ios::binary} {
+        if (!_file) {
+            throw logic_error{error_code::k_create_resource_fail, "cannot open trace file " + path};
+        }
+    }
+
+    void write(span const& s) {
+        auto const doc = to_document(s);
+        std::string const line = bsoncxx::v_noabi::to_json(doc.view(), bsoncxx::v_noabi::ExtendedJsonMode::k_relaxed);
+
+        std::lock_guard<std::mutex> lock{_mutex};
+        _file << line << '\n';
+    }
+
+    void flush() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _file.flush();
+    }
+
+   private:
+    std::mutex _mutex;
+    std::ofstream _file;
+};
+
+file_exporter::file_exporter(bsoncxx::v_noabi::string::view_or_value path)
+    : _impl{bsoncxx::make_unique<impl>(std::string{path.view()})} {}
+
+file_exporter::~file_exporter() = default;
+
+void file_exporter::operator()(span const& s) noexcept {
+    try {
+        _impl->write(s);
+    } catch (...) {
+        // Spans are diagnostic: drop the span rather than fail the command.
+    }
+}
+
+void file_exporter::flush() {
+    _impl->flush();
+}
+
+} // namespace tracing
+} // namespace v_noabi
+} // namespace mongocxx
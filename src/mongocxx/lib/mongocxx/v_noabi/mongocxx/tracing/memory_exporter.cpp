@@ -0,0 +1,89 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/tracing/memory_exporter.hpp>
+
+//
+
+#include <deque>
+#include <mutex>
+
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace tracing {
+
+class memory_exporter::impl {
+   public:
+    explicit impl(std::size_t capacity) : _capacity{capacity} {}
+
+    void push(span const& s) {
+        std::lock_guard<std::mutex> lock{_mutex};
+
+        if (_spans.size() == _capacity) {
+            _spans.pop_front();
+        }
+
+        _spans.push_back(s);
+    }
+
+    std::vector<span> spans() const {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return {_spans.begin(), _spans.end()};
+    }
+
+    void clear() noexcept {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _spans.clear();
+    }
+
+   private:
+    std::size_t const _capacity;
+    mutable std::mutex _mutex;
+    std::deque<span> _spans;
+};
+
+memory_exporter::memory_exporter(std::size_t capacity) {
+    if (capacity == 0u) {
+        throw logic_error{error_code::k_invalid_parameter};
+    }
+
+    _impl = bsoncxx::make_unique<impl>(capacity);
+}
+
+memory_exporter::~memory_exporter() = default;
+
+void memory_exporter::operator()(span const& s) noexcept {
+    try {
+        _impl->push(s);
+    } catch (...) {
+        // Spans are diagnostic: drop the span rather than fail the command.
+    }
+}
+
+std::vector<span> memory_exporter::spans() const {
+    return _impl->spans();
+}
+
+void memory_exporter::clear() noexcept {
+    _impl->clear();
+}
+
+} // namespace tracing
+} // namespace v_noabi
+} // namespace mongocxx
@@ -0,0 +1,183 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/tracing/tracer.hpp>
+
+//
+
+#include <chrono>
+#include <string>
+#include <utility>
+
+#include <bsoncxx/document/element.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <mongocxx/exception/error_code.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+
+#include <bsoncxx/private/make_unique.hh>
+
+#include <mongocxx/private/command_collection.hh>
+
+namespace mongocxx {
+namespace v_noabi {
+namespace tracing {
+
+namespace {
+
+void assign(std::string& out, bsoncxx::v_noabi::stdx::string_view value) {
+    out.assign(value.data(), value.size());
+}
+
+void assign_string_field(std::string& out, bsoncxx::v_noabi::document::element const& element) {
+    if (element && element.type() == bsoncxx::v_noabi::type::k_string) {
+        assign(out, element.get_string().value);
+    } else {
+        out.clear();
+    }
+}
+
+// The span started by this thread and not yet finished. The events of a command are published by
+// the thread running the command with no other command in between.
+struct pending_span {
+    void const* owner;
+    span value;
+};
+
+thread_local pending_span pending = {};
+
+// The last span finished by this thread, used to detect retries.
+struct finished_span {
+    void const* owner;
+    std::int64_t operation_id;
+    std::string command_name;
+    std::uint32_t attempt;
+    bool failed;
+};
+
+thread_local finished_span last_finished = {};
+
+} // namespace
+
+class tracer::impl {
+   public:
+    explicit impl(std::shared_ptr<tracing::exporter> exporter) : _exporter{std::move(exporter)} {}
+
+    void start(events::command_started_event const& event) {
+        span& s = pending.value;
+
+        pending.owner = nullptr;
+
+        assign(s.command_name, event.command_name());
+        assign(s.database_name, event.database_name());
+        assign(s.collection_name, command_collection_name(event.command_name(), event.command()));
+        assign(s.host, event.host());
+        s.port = event.port();
+        s.service_id = event.service_id();
+        s.request_id = event.request_id();
+        s.operation_id = event.operation_id();
+
+        // A command is a retry if the previous command of the same operation failed.
+        if (last_finished.owner == this && last_finished.failed && last_finished.operation_id == s.operation_id &&
+            last_finished.command_name == s.command_name) {
+            s.attempt = last_finished.attempt + 1u;
+        } else {
+            s.attempt = 1u;
+        }
+
+        s.start_time = std::chrono::system_clock::now();
+        s.duration = std::chrono::microseconds{0};
+        s.failed = false;
+        s.error_message.clear();
+
+        pending.owner = this;
+    }
+
+    void finish(std::int64_t request_id, std::int64_t duration, bsoncxx::v_noabi::document::view const* failure) {
+        span& s = pending.value;
+
+        if (pending.owner != this || s.request_id != request_id) {
+            return;
+        }
+
+        pending.owner = nullptr;
+
+        s.duration = std::chrono::microseconds{duration};
+        s.failed = failure != nullptr;
+
+        if (failure) {
+            assign_string_field(s.error_message, (*failure)["errmsg"]);
+        }
+
+        last_finished.owner = nullptr;
+        last_finished.operation_id = s.operation_id;
+        last_finished.command_name = s.command_name;
+        last_finished.attempt = s.attempt;
+        last_finished.failed = s.failed;
+        last_finished.owner = this;
+
+        (*_exporter)(s);
+    }
+
+    std::shared_ptr<tracing::exporter> const& exporter() const noexcept {
+        return _exporter;
+    }
+
+   private:
+    std::shared_ptr<tracing::exporter> const _exporter;
+};
+
+tracer::tracer(std::shared_ptr<tracing::exporter> exporter) {
+    if (!exporter) {
+        throw logic_error{error_code::k_invalid_parameter};
+    }
+
+    _impl = bsoncxx::make_unique<impl>(std::move(exporter));
+}
+
+tracer::~tracer() = default;
+
+void tracer::start(events::command_started_event const& event) noexcept {
+    try {
+        _impl->start(event);
+    } catch (...) {
+        // Spans are diagnostic: drop the span rather than fail the command.
+        pending.owner = nullptr;
+    }
+}
+
+void tracer::finish(events::command_succeeded_event const& event) noexcept {
+    try {
+        _impl->finish(event.request_id(), event.duration(), nullptr);
+    } catch (...) {
+        last_finished.owner = nullptr;
+    }
+}
+
+void tracer::finish(events::command_failed_event const& event) noexcept {
+    try {
+        auto const failure = event.failure();
+        _impl->finish(event.request_id(), event.duration(), &failure);
+    } catch (...) {
+        last_finished.owner = nullptr;
+    }
+}
+
+std::shared_ptr<tracing::exporter> const& tracer::exporter() const noexcept {
+    return _impl->exporter();
+}
+
+} // namespace tracing
+} // namespace v_noabi
+} // namespace mongocxx
@@ -0,0 +1,206 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/test/v_noabi/client_helpers.hh>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+
+#include <mongocxx/apm_dispatcher.hpp>
+#include <mongocxx/client.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/apm.hpp>
+#include <mongocxx/options/client.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+using namespace mongocxx;
+
+client make_client(std::shared_ptr<apm_dispatcher> dispatcher) {
+    options::apm apm_opts;
+    apm_opts.dispatcher(std::move(dispatcher));
+
+    auto client_opts = test_util::add_test_server_api();
+    client_opts.apm_opts(apm_opts);
+
+    return client{uri{}, client_opts};
+}
+
+TEST_CASE("apm_dispatcher validates its arguments", "[apm_dispatcher]") {
+    auto const ignore = [](apm_dispatcher::record const&) {};
+
+    CHECK_THROWS_AS(apm_dispatcher(apm_dispatcher::listener{}), logic_error);
+    CHECK_THROWS_AS(apm_dispatcher(ignore, 0u), logic_error);
+
+    CHECK(apm_dispatcher(ignore).capacity() == apm_dispatcher::k_default_capacity);
+    CHECK(apm_dispatcher(ignore, 1u).capacity() == 1u);
+    CHECK(apm_dispatcher(ignore, 1000u).capacity() == 1024u);
+
+    options::apm apm_opts;
+
+    CHECK_FALSE(apm_opts.dispatcher());
+
+    auto const dispatcher = std::make_shared<apm_dispatcher>(ignore);
+    apm_opts.dispatcher(dispatcher);
+
+    CHECK(apm_opts.dispatcher() == dispatcher);
+}
+
+TEST_CASE("apm_dispatcher delivers command events on a background thread", "[apm_dispatcher]") {
+    instance::current();
+
+    auto const caller = std::this_thread::get_id();
+
+    // Only accessed by the background thread until flush() returns.
+    std::vector<apm_dispatcher::record> records;
+    bool same_thread = false;
+
+    auto const dispatcher = std::make_shared<apm_dispatcher>([&](apm_dispatcher::record const& r) {
+        same_thread = same_thread || std::this_thread::get_id() == caller;
+        records.push_back(r);
+    });
+
+    auto client = make_client(dispatcher);
+
+    client["admin"].run_command(make_document(kvp("ping", 1)));
+    CHECK_THROWS(client["admin"].run_command(make_document(kvp("notACommand", 1))));
+
+    dispatcher->flush();
+
+    CHECK_FALSE(same_thread);
+
+    bool found_started = false;
+    bool found_succeeded = false;
+    bool found_failed = false;
+
+    for (auto const& r : records) {
+        if (r.command_name == "ping" && r.type == apm_dispatcher::kind::k_command_started) {
+            found_started = r.database_name == "admin" && r.document_view()["ping"];
+        }
+
+        if (r.command_name == "ping" && r.type == apm_dispatcher::kind::k_command_succeeded) {
+            found_succeeded = r.duration >= 0 && r.document_view()["ok"];
+        }
+
+        if (r.command_name == "notACommand" && r.type == apm_dispatcher::kind::k_command_failed) {
+            found_failed = !r.host.empty() && r.port != 0;
+        }
+    }
+
+    CHECK(found_started);
+    CHECK(found_succeeded);
+    CHECK(found_failed);
+
+    auto const stats = dispatcher->stats();
+
+    CHECK(stats.delivered == records.size());
+    CHECK(stats.posted == stats.delivered);
+    CHECK(stats.dropped == 0u);
+}
+
+TEST_CASE("apm_dispatcher can omit documents", "[apm_dispatcher]") {
+    instance::current();
+
+    std::atomic<std::uint64_t> with_document{0};
+
+    auto const dispatcher = std::make_shared<apm_dispatcher>(
+        [&](apm_dispatcher::record const& r) {
+            if (!r.document.empty()) {
+                ++with_document;
+            }
+        },
+        apm_dispatcher::k_default_capacity,
+        false);
+
+    auto client = make_client(dispatcher);
+
+    client["admin"].run_command(make_document(kvp("ping", 1)));
+
+    dispatcher->flush();
+
+    CHECK(dispatcher->stats().delivered >= 2u);
+    CHECK(with_document.load() == 0u);
+}
+
+TEST_CASE("apm_dispatcher drops events when the buffer is full", "[apm_dispatcher]") {
+    instance::current();
+
+    std::atomic<bool> blocked{true};
+
+    // The listener holds the only record of the buffer until it is released.
+    auto const dispatcher = std::make_shared<apm_dispatcher>(
+        [&](apm_dispatcher::record const&) {
+            while (blocked.load()) {
+                std::this_thread::yield();
+            }
+        },
+        1u);
+
+    {
+        auto client = make_client(dispatcher);
+
+        for (int i = 0; i < 3; ++i) {
+            client["admin"].run_command(make_document(kvp("ping", 1)));
+        }
+    }
+
+    blocked.store(false);
+    dispatcher->flush();
+
+    auto const stats = dispatcher->stats();
+
+    CHECK(stats.dropped > 0u);
+    CHECK(stats.posted == stats.delivered);
+}
+
+TEST_CASE("apm_dispatcher survives a throwing listener", "[apm_dispatcher]") {
+    instance::current();
+
+    std::atomic<std::uint64_t> calls{0};
+
+    auto const dispatcher = std::make_shared<apm_dispatcher>([&](apm_dispatcher::record const&) {
+        ++calls;
+        throw std::runtime_error{"listener failure"};
+    });
+
+    auto client = make_client(dispatcher);
+
+    client["admin"].run_command(make_document(kvp("ping", 1)));
+    client["admin"].run_command(make_document(kvp("ping", 1)));
+
+    dispatcher->flush();
+
+    auto const stats = dispatcher->stats();
+
+    CHECK(calls.load() >= 4u);
+    CHECK(stats.delivered == calls.load());
+    CHECK(stats.posted == stats.delivered);
+    CHECK(stats.dropped == 0u);
+}
+
+} // namespace
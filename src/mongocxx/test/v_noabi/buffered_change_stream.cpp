@@ -0,0 +1,152 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/test/v_noabi/client_helpers.hh>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+
+#include <mongocxx/buffered_change_stream.hpp>
+#include <mongocxx/client.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/buffered_change_stream.hpp>
+#include <mongocxx/options/change_stream.hpp>
+#include <mongocxx/pool.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+using namespace mongocxx;
+
+TEST_CASE("buffered_change_stream options", "[buffered_change_stream]") {
+    options::buffered_change_stream opts;
+
+    CHECK_FALSE(opts.capacity());
+    CHECK_FALSE(opts.low_watermark());
+
+    opts.capacity(8u).low_watermark(2u);
+
+    CHECK(opts.capacity() == 8u);
+    CHECK(opts.low_watermark() == 2u);
+}
+
+TEST_CASE("buffered_change_stream buffers events with backpressure", "[buffered_change_stream]") {
+    instance::current();
+    mongocxx::pool pool{uri{}, options::pool(test_util::add_test_server_api())};
+
+    if (!test_util::is_replica_set()) {
+        SKIP("change streams require replica set");
+    }
+
+    auto client = pool.acquire();
+    auto coll = (*client)["streams"]["buffered"];
+    coll.drop();
+    coll = (*client)["streams"].create_collection("buffered");
+
+    options::change_stream cs_opts;
+    cs_opts.max_await_time(std::chrono::milliseconds{100});
+
+    // The watching client is dedicated to the background thread.
+    auto watcher = pool.acquire();
+    auto watched = (*watcher)["streams"]["buffered"];
+
+    SECTION("Invalid capacity") {
+        options::buffered_change_stream opts;
+
+        SECTION("Zero") {
+            opts.capacity(0u);
+        }
+
+        SECTION("Low watermark not below capacity") {
+            opts.capacity(4u).low_watermark(4u);
+        }
+
+        REQUIRE_THROWS_AS((buffered_change_stream{watched.watch(cs_opts), opts}), logic_error);
+    }
+
+    SECTION("Delivers every event in order") {
+        constexpr std::size_t capacity = 4u;
+        constexpr std::int32_t n_events = 16;
+
+        options::buffered_change_stream opts;
+        opts.capacity(capacity).low_watermark(1u);
+
+        buffered_change_stream stream{watched.watch(cs_opts), opts};
+
+        for (std::int32_t i = 0; i < n_events; ++i) {
+            coll.insert_one(make_document(kvp("_id", i)));
+        }
+
+        std::vector<std::int32_t> ids;
+        while (ids.size() < static_cast<std::size_t>(n_events)) {
+            auto const event = stream.pop_for(std::chrono::seconds{10});
+            REQUIRE(event);
+            REQUIRE(stream.depth() <= capacity);
+            ids.push_back(event->view()["documentKey"]["_id"].get_int32().value);
+
+            // Let the queue fill up to exercise backpressure.
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        }
+
+        for (std::int32_t i = 0; i < n_events; ++i) {
+            REQUIRE(ids[static_cast<std::size_t>(i)] == i);
+        }
+
+        stream.stop();
+
+        REQUIRE(stream.stopped());
+        REQUIRE_FALSE(stream.pop());
+        REQUIRE_FALSE(stream.try_pop());
+
+        auto const stats = stream.stats();
+        CHECK(stats.depth == 0u);
+        CHECK(stats.max_depth <= capacity);
+        CHECK(stats.received == static_cast<std::uint64_t>(n_events));
+        CHECK(stats.consumed == static_cast<std::uint64_t>(n_events));
+    }
+
+    SECTION("Stops at the end of the stream") {
+        buffered_change_stream stream{watched.watch(cs_opts)};
+
+        coll.insert_one(make_document(kvp("_id", 1)));
+        coll.drop();
+
+        std::vector<std::string> types;
+
+        // pop() returns an unset optional once the stream has ended and the queue is drained.
+        while (auto const event = stream.pop()) {
+            types.emplace_back(event->view()["operationType"].get_string().value);
+        }
+
+        REQUIRE(stream.stopped());
+        REQUIRE_FALSE(types.empty());
+        CHECK(types.front() == "insert");
+        CHECK(types.back() == "invalidate");
+    }
+}
+
+} // namespace
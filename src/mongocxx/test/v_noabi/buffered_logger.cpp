@@ -0,0 +1,135 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <mongocxx/buffered_logger.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+#include <mongocxx/logger.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using namespace mongocxx;
+
+class recording_logger : public logger {
+   public:
+    using event = std::tuple<log_level, std::string, std::string>;
+
+    explicit recording_logger(std::vector<event>* events) : _events(events) {}
+
+    void operator()(log_level level, bsoncxx::stdx::string_view domain, bsoncxx::stdx::string_view message) noexcept
+        final {
+        _events->emplace_back(level, std::string(domain), std::string(message));
+    }
+
+   private:
+    std::vector<event>* _events;
+};
+
+std::unique_ptr<logger> make_sink(std::vector<recording_logger::event>* events) {
+    return std::unique_ptr<logger>{new recording_logger{events}};
+}
+
+TEST_CASE("buffered_logger options", "[buffered_logger]") {
+    std::vector<recording_logger::event> events;
+
+    CHECK_THROWS_AS(buffered_logger{nullptr}, logic_error);
+    CHECK_THROWS_AS((buffered_logger{make_sink(&events), log_level::k_info, 0u}), logic_error);
+
+    buffered_logger log{make_sink(&events)};
+
+    CHECK(log.level() == log_level::k_info);
+    log.level(log_level::k_trace);
+    CHECK(log.level() == log_level::k_trace);
+}
+
+TEST_CASE("buffered_logger filters messages before buffering them", "[buffered_logger]") {
+    std::vector<recording_logger::event> events;
+
+    {
+        buffered_logger log{make_sink(&events), log_level::k_warning};
+        log.ignore_domain("cluster");
+
+        log(log_level::k_error, "client", "error");
+        log(log_level::k_warning, "client", "warning");
+        log(log_level::k_info, "client", "info");
+        log(log_level::k_error, "cluster", "ignored");
+
+        log.flush();
+
+        auto const stats = log.stats();
+
+        CHECK(stats.written == 2u);
+        CHECK(stats.dropped == 0u);
+        CHECK(stats.filtered == 2u);
+
+        log.level(log_level::k_debug);
+        log(log_level::k_debug, "client", "debug");
+    }
+
+    // The buffered messages are written when the logger is destroyed.
+    REQUIRE(events.size() == 3u);
+    CHECK(events[0] == std::make_tuple(log_level::k_error, "client", "error"));
+    CHECK(events[1] == std::make_tuple(log_level::k_warning, "client", "warning"));
+    CHECK(events[2] == std::make_tuple(log_level::k_debug, "client", "debug"));
+}
+
+TEST_CASE("buffered_logger truncates long messages", "[buffered_logger]") {
+    std::vector<recording_logger::event> events;
+
+    buffered_logger log{make_sink(&events)};
+
+    log(log_level::k_error, "client", std::string(buffered_logger::k_max_message_size + 10u, 'x'));
+    log.flush();
+
+    REQUIRE(events.size() == 1u);
+    CHECK(std::get<2>(events[0]).size() == buffered_logger::k_max_message_size);
+}
+
+TEST_CASE("buffered_logger counts the messages dropped when full", "[buffered_logger]") {
+    std::vector<recording_logger::event> events;
+    std::size_t const per_thread = 1000u;
+
+    buffered_logger log{make_sink(&events), log_level::k_info, 4u};
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] {
+            for (std::size_t j = 0; j < per_thread; ++j) {
+                log(log_level::k_info, "client", "message");
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    log.flush();
+
+    auto const stats = log.stats();
+
+    CHECK(stats.written + stats.dropped == 4u * per_thread);
+    CHECK(stats.written == events.size());
+}
+
+} // namespace
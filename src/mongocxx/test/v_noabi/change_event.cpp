@@ -0,0 +1,156 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <mongocxx/change_event.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_array;
+using bsoncxx::builder::basic::make_document;
+
+using mongocxx::change_event;
+
+TEST_CASE("change_event decodes an update notification", "[change_event]") {
+    auto const event = make_document(
+        kvp("_id", make_document(kvp("_data", "826ABC"))),
+        kvp("operationType", "update"),
+        kvp("clusterTime", bsoncxx::types::b_timestamp{1u, 1700000000u}),
+        kvp("ns", make_document(kvp("db", "db"), kvp("coll", "coll"))),
+        kvp("documentKey", make_document(kvp("shard", 1), kvp("_id", std::int32_t{42}))),
+        kvp("updateDescription",
+            make_document(
+                kvp("updatedFields", make_document(kvp("x", 2))), kvp("removedFields", make_array("y", "z")))));
+
+    change_event const ce{event.view()};
+
+    CHECK(ce.view().data() == event.view().data());
+    CHECK(ce.operation() == change_event::operation_type::k_update);
+    CHECK(ce.operation_name() == "update");
+    CHECK(ce.database() == "db");
+    CHECK(ce.collection() == "coll");
+
+    REQUIRE(ce.resume_token());
+    CHECK(*ce.resume_token() == make_document(kvp("_data", "826ABC")));
+
+    REQUIRE(ce.cluster_time());
+    CHECK(ce.cluster_time()->timestamp == 1700000000u);
+    CHECK(ce.cluster_time()->increment == 1u);
+
+    REQUIRE(ce.document_key());
+    REQUIRE(ce.document_key_id());
+    CHECK(ce.document_key_id().get_int32().value == 42);
+
+    REQUIRE(ce.updated_fields());
+    CHECK(*ce.updated_fields() == make_document(kvp("x", 2)));
+
+    REQUIRE(ce.removed_fields());
+    CHECK(*ce.removed_fields() == make_array("y", "z"));
+
+    CHECK_FALSE(ce.full_document());
+}
+
+TEST_CASE("change_event decodes an insert notification", "[change_event]") {
+    auto const event = make_document(
+        kvp("_id", make_document(kvp("_data", "826ABD"))),
+        kvp("operationType", "insert"),
+        kvp("fullDocument", make_document(kvp("_id", "a"), kvp("x", 1))),
+        kvp("ns", make_document(kvp("db", "db"), kvp("coll", "coll"))),
+        kvp("documentKey", make_document(kvp("_id", "a"))));
+
+    change_event const ce{event.view()};
+
+    CHECK(ce.operation() == change_event::operation_type::k_insert);
+
+    REQUIRE(ce.full_document());
+    CHECK(*ce.full_document() == make_document(kvp("_id", "a"), kvp("x", 1)));
+
+    REQUIRE(ce.document_key_id());
+    CHECK(ce.document_key_id().get_string().value == "a");
+
+    CHECK_FALSE(ce.updated_fields());
+    CHECK_FALSE(ce.removed_fields());
+    CHECK_FALSE(ce.cluster_time());
+}
+
+TEST_CASE("change_event decodes operation types", "[change_event]") {
+    using operation_type = change_event::operation_type;
+
+    struct test_case {
+        char const* name;
+        operation_type type;
+    };
+
+    auto tc = GENERATE(values<test_case>({
+        {"insert", operation_type::k_insert},
+        {"update", operation_type::k_update},
+        {"replace", operation_type::k_replace},
+        {"delete", operation_type::k_delete},
+        {"drop", operation_type::k_drop},
+        {"rename", operation_type::k_rename},
+        {"dropDatabase", operation_type::k_drop_database},
+        {"invalidate", operation_type::k_invalidate},
+        {"createIndexes", operation_type::k_other},
+    }));
+
+    CAPTURE(tc.name);
+
+    auto const event = make_document(kvp("operationType", tc.name));
+    change_event const ce{event.view()};
+
+    CHECK(ce.operation() == tc.type);
+    CHECK(ce.operation_name() == tc.name);
+}
+
+TEST_CASE("change_event treats missing or mistyped fields as absent", "[change_event]") {
+    auto const event = make_document(
+        kvp("_id", "not a document"),
+        kvp("operationType", 1),
+        kvp("ns", make_document(kvp("db", 1))),
+        kvp("documentKey", make_document(kvp("x", 1))),
+        kvp("fullDocument", bsoncxx::types::b_null{}),
+        kvp("updateDescription", make_document(kvp("updatedFields", make_array()))),
+        kvp("clusterTime", 1));
+
+    change_event const ce{event.view()};
+
+    CHECK_FALSE(ce.resume_token());
+    CHECK(ce.operation() == change_event::operation_type::k_other);
+    CHECK(ce.operation_name().empty());
+    CHECK(ce.database().empty());
+    CHECK(ce.collection().empty());
+    CHECK(ce.document_key());
+    CHECK_FALSE(ce.document_key_id());
+    CHECK_FALSE(ce.full_document());
+    CHECK_FALSE(ce.updated_fields());
+    CHECK_FALSE(ce.removed_fields());
+    CHECK_FALSE(ce.cluster_time());
+
+    change_event const empty;
+
+    CHECK(empty.view().empty());
+    CHECK_FALSE(empty.resume_token());
+}
+
+} // namespace
@@ -0,0 +1,180 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/test/v_noabi/client_helpers.hh>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <mongocxx/change_stream_router.hpp>
+#include <mongocxx/client.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/change_stream.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_array;
+using bsoncxx::builder::basic::make_document;
+
+using namespace mongocxx;
+
+bsoncxx::document::value make_event(char const* db, char const* coll, std::uint32_t time) {
+    return make_document(
+        kvp("operationType", "insert"),
+        kvp("clusterTime", bsoncxx::types::b_timestamp{0u, time}),
+        kvp("ns", make_document(kvp("db", db), kvp("coll", coll))));
+}
+
+TEST_CASE("change_stream_router routes by namespace", "[change_stream_router]") {
+    std::vector<std::string> seen;
+
+    auto record = [&](change_event const& event) {
+        seen.push_back(std::string{event.database()} + "." + std::string{event.collection()});
+    };
+
+    change_stream_router router;
+    router.route("db", "b", record).route("db", "a", record).route("other", "a", record);
+
+    REQUIRE(router.routes() == 3u);
+
+    SECTION("Filter") {
+        auto const expected = make_document(kvp(
+            "$or",
+            make_array(
+                make_document(kvp("ns.db", "db"), kvp("ns.coll", make_document(kvp("$in", make_array("a", "b"))))),
+                make_document(kvp("ns.db", "other"), kvp("ns.coll", make_document(kvp("$in", make_array("a"))))))));
+
+        REQUIRE(router.filter() == expected.view());
+    }
+
+    SECTION("Dispatch") {
+        REQUIRE(router.dispatch(make_event("db", "a", 1u)));
+        REQUIRE(router.dispatch(make_event("other", "a", 2u)));
+        REQUIRE(router.dispatch(make_event("db", "a", 3u)));
+        REQUIRE_FALSE(router.dispatch(make_event("db", "c", 4u)));
+        REQUIRE_FALSE(router.dispatch(make_document(kvp("operationType", "dropDatabase"))));
+
+        REQUIRE(seen == std::vector<std::string>({"db.a", "other.a", "db.a"}));
+        REQUIRE(router.unrouted() == 2u);
+
+        auto const a = router.stats("db", "a");
+        REQUIRE(a);
+        CHECK(a->delivered == 2u);
+        REQUIRE(a->last_cluster_time);
+        CHECK(a->last_cluster_time->timestamp == 3u);
+
+        auto const b = router.stats("db", "b");
+        REQUIRE(b);
+        CHECK(b->delivered == 0u);
+        CHECK_FALSE(b->last_cluster_time);
+
+        CHECK_FALSE(router.stats("db", "c"));
+    }
+
+    SECTION("Replacing a route keeps its position") {
+        int replaced = 0;
+        router.route("db", "a", [&](change_event const&) { ++replaced; });
+
+        REQUIRE(router.routes() == 3u);
+        REQUIRE(router.dispatch(make_event("db", "a", 1u)));
+        REQUIRE(replaced == 1);
+        REQUIRE(seen.empty());
+    }
+
+    SECTION("Fallback") {
+        int fallbacks = 0;
+        router.fallback([&](change_event const& event) {
+            CHECK(event.operation() == change_event::operation_type::k_drop_database);
+            ++fallbacks;
+        });
+
+        REQUIRE(router.filter()["$or"].get_array().value[2].get_document().value ==
+                make_document(kvp("ns.coll", make_document(kvp("$exists", false)))).view());
+
+        REQUIRE(router.dispatch(make_document(kvp("operationType", "dropDatabase"))));
+        REQUIRE(fallbacks == 1);
+        REQUIRE(router.unrouted() == 0u);
+    }
+
+    SECTION("Invalid routes") {
+        REQUIRE_THROWS_AS(router.route("", "a", record), logic_error);
+        REQUIRE_THROWS_AS(router.route("db", "", record), logic_error);
+        REQUIRE_THROWS_AS(router.route("db", "a", nullptr), logic_error);
+    }
+}
+
+TEST_CASE("change_stream_router with no routes matches nothing", "[change_stream_router]") {
+    change_stream_router router;
+
+    REQUIRE(router.filter() == make_document(kvp("ns.coll", make_document(kvp("$in", make_array())))).view());
+    REQUIRE_FALSE(router.dispatch(make_event("db", "a", 1u)));
+}
+
+TEST_CASE("change_stream_router watches a database with one cursor", "[change_stream_router]") {
+    instance::current();
+    client client{uri{}, test_util::add_test_server_api()};
+
+    if (!test_util::is_replica_set()) {
+        SKIP("change streams require replica set");
+    }
+
+    auto db = client["router"];
+    db.drop();
+
+    auto a = db.create_collection("a");
+    auto b = db.create_collection("b");
+    auto c = db.create_collection("c");
+
+    int a_events = 0;
+    int b_events = 0;
+
+    change_stream_router router;
+    router.route("router", "a", [&](change_event const&) { ++a_events; });
+    router.route("router", "b", [&](change_event const&) { ++b_events; });
+
+    options::change_stream opts;
+    opts.max_await_time(std::chrono::milliseconds{100});
+
+    auto stream = router.watch(db, {}, opts);
+
+    a.insert_one(make_document(kvp("x", 1)));
+    c.insert_one(make_document(kvp("x", 1)));
+    b.insert_one(make_document(kvp("x", 1)));
+    a.insert_one(make_document(kvp("x", 2)));
+
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (a_events + b_events < 3 && std::chrono::steady_clock::now() < deadline) {
+        router.dispatch(stream.next_batch());
+    }
+
+    REQUIRE(a_events == 2);
+    REQUIRE(b_events == 1);
+
+    // The collection which is not routed is filtered out by the server.
+    REQUIRE(router.unrouted() == 0u);
+    REQUIRE(router.stats("router", "a")->delivered == 2u);
+}
+
+} // namespace
@@ -23,7 +23,9 @@
 
 #include <mongocxx/client.hpp>
 #include <mongocxx/collection.hpp>
+#include <mongocxx/exception/query_exception.hpp>
 #include <mongocxx/instance.hpp>
+#include <mongocxx/options/apm.hpp>
 #include <mongocxx/options/insert.hpp>
 #include <mongocxx/options/pool.hpp>
 #include <mongocxx/pipeline.hpp>
@@ -33,6 +35,7 @@
 #include <bsoncxx/private/bson.hh>
 
 #include <mongocxx/private/bson.hh>
+#include <mongocxx/private/change_stream_batch.hh>
 
 #include <bsoncxx/test/catch.hh>
 
@@ -133,6 +136,14 @@ TEST_CASE("Change stream options", "[change_stream]") {
     }
 }
 
+TEST_CASE("change_stream_batches option", "[change_stream]") {
+    options::apm apm_opts;
+
+    CHECK_FALSE(apm_opts.change_stream_batches());
+    apm_opts.change_stream_batches(true);
+    CHECK(apm_opts.change_stream_batches());
+}
+
 TEST_CASE("Spec Prose Tests", "[change_stream]") {
     instance::current();
     client client{uri{}, test_util::add_test_server_api()};
@@ -314,6 +325,141 @@ TEST_CASE("Mock streams and error-handling", "[change_stream]") {
         }
     }
 
+    SECTION("Batch of events") {
+        static mongocxx::libbson::scoped_bson_t token{make_document(kvp("token", 1))};
+
+        auto change_stream_get_resume_token = libmongoc::change_stream_get_resume_token.create_instance();
+        change_stream_get_resume_token->interpose([](mongoc_change_stream_t const*) -> bson_t const* {
+            return token.bson();
+        })
+            .forever();
+
+        // Two events, then nothing forever.
+        change_stream_next->interpose(gen_next(false)).forever();
+        change_stream_next->interpose(gen_next(true)).times(2);
+        change_stream_error_document->interpose(gen_error(false)).forever();
+
+        SECTION("Reads all available events") {
+            auto batch = stream.next_batch();
+            REQUIRE(batch.size() == 2u);
+            for (auto const& event : batch) {
+                REQUIRE(event == make_document(kvp("some", "doc")).view());
+            }
+            REQUIRE(batch.resume_token() == make_document(kvp("token", 1)).view());
+
+            SECTION("Then an empty batch") {
+                REQUIRE(stream.next_batch().empty());
+            }
+        }
+
+        SECTION("Respects max_events") {
+            REQUIRE(stream.next_batch(1u).size() == 1u);
+            REQUIRE(stream.next_batch(1u).size() == 1u);
+            REQUIRE(stream.next_batch(1u).empty());
+        }
+
+        SECTION("Views remain valid after move") {
+            auto batch = stream.next_batch();
+            auto moved = std::move(batch);
+            REQUIRE(moved.events().at(1) == make_document(kvp("some", "doc")).view());
+        }
+
+        SECTION("Throws on error") {
+            change_stream_next->interpose(gen_next(false));
+            change_stream_error_document->interpose(gen_error(true));
+            REQUIRE_THROWS(stream.next_batch());
+            REQUIRE(std::distance(stream.begin(), stream.end()) == 0);
+        }
+    }
+
+    SECTION("Batch of events with ids") {
+        // The resume token of an event is its _id. The postBatchResumeToken of a batch commonly
+        // equals the _id of its last event, so the token does not change at the end of the batch.
+        static bsoncxx::document::value const ids[] = {
+            make_document(kvp("_data", "1")),
+            make_document(kvp("_data", "2")),
+            make_document(kvp("_data", "3")),
+        };
+        static bsoncxx::document::value const with_ids[] = {
+            make_document(kvp("_id", ids[0].view()), kvp("n", 1)),
+            make_document(kvp("_id", ids[1].view()), kvp("n", 2)),
+            make_document(kvp("_id", ids[2].view()), kvp("n", 3)),
+        };
+
+        static bson_t id_bsons[3];
+        static bson_t with_id_bsons[3];
+
+        for (std::size_t i = 0u; i < 3u; ++i) {
+            bson_init_static(&id_bsons[i], ids[i].view().data(), ids[i].view().length());
+            bson_init_static(&with_id_bsons[i], with_ids[i].view().data(), with_ids[i].view().length());
+        }
+
+        // The replies of the getMore commands libmongoc issues for the two batches.
+        static mongocxx::libbson::scoped_bson_t first_reply{make_document(
+            kvp("cursor", make_document(kvp("nextBatch", make_array(with_ids[0].view(), with_ids[1].view())))))};
+        static mongocxx::libbson::scoped_bson_t second_reply{
+            make_document(kvp("cursor", make_document(kvp("nextBatch", make_array(with_ids[2].view())))))};
+
+        std::size_t returned = 0u;
+        bool error = false;
+
+        change_stream_next->interpose([&](mongoc_change_stream_t*, bson_t const** bson) -> bool {
+            // Command monitoring reports each getMore to the stream reading the batch.
+            if (returned == 0u) {
+                change_stream_batch::observe("getMore", first_reply.bson());
+            } else if (returned == 2u) {
+                change_stream_batch::observe("getMore", second_reply.bson());
+            }
+
+            if (returned == 3u || (error && returned == 1u)) {
+                return false;
+            }
+
+            *bson = &with_id_bsons[returned++];
+            return true;
+        })
+            .forever();
+
+        auto change_stream_get_resume_token = libmongoc::change_stream_get_resume_token.create_instance();
+        change_stream_get_resume_token
+            ->interpose([&](mongoc_change_stream_t const*) -> bson_t const* {
+                return returned == 0u ? nullptr : &id_bsons[returned - 1u];
+            })
+            .forever();
+
+        change_stream_error_document
+            ->interpose([&](mongoc_change_stream_t const* cs, bson_error_t* err, bson_t const** bson) -> bool {
+                return gen_error(error)(cs, err, bson);
+            })
+            .forever();
+
+        SECTION("Stops at the end of a server batch") {
+            auto const first = stream.next_batch();
+            REQUIRE(returned == 2u);
+            REQUIRE(first.size() == 2u);
+            REQUIRE(first.events().at(1)["n"].get_int32().value == 2);
+            REQUIRE(first.resume_token() == ids[1].view());
+
+            auto const second = stream.next_batch();
+            REQUIRE(returned == 3u);
+            REQUIRE(second.size() == 1u);
+            REQUIRE(second.resume_token() == ids[2].view());
+
+            REQUIRE(stream.next_batch().empty());
+        }
+
+        SECTION("Returns the events read before an error") {
+            error = true;
+
+            auto const first = stream.next_batch();
+            REQUIRE(first.size() == 1u);
+            REQUIRE(first.resume_token() == ids[0].view());
+
+            REQUIRE_THROWS_AS(stream.next_batch(), query_exception);
+            REQUIRE(std::distance(stream.begin(), stream.end()) == 0);
+        }
+    }
+
     SECTION("Pipeline and opts are passed for all watch helpers") {
         bsoncxx::types::b_timestamp ts{1, 2};
         std::int32_t batch_size = 3;
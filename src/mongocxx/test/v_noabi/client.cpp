@@ -368,6 +368,107 @@ TEST_CASE("A client can create a named database object", "[client]") {
     REQUIRE(obtained_database.name() == name);
 }
 
+TEST_CASE("A client creates a cached database object once", "[client]") {
+    MOCK_CLIENT;
+
+    instance::current();
+
+    int get_database_calls = 0;
+
+    auto database_get = libmongoc::client_get_database.create_instance();
+    database_get
+        ->interpose([&](mongoc_client_t*, char const*) {
+            ++get_database_calls;
+            return nullptr;
+        })
+        .forever();
+    auto database_destroy = libmongoc::database_destroy.create_instance();
+    database_destroy->interpose([](mongoc_database_t*) {}).forever();
+
+    client mongo_client{uri{}, test_util::add_test_server_api()};
+
+    database& first = mongo_client.cached_database("database");
+    database& second = mongo_client.cached_database("database");
+    database& other = mongo_client.cached_database("other");
+
+    REQUIRE(&first == &second);
+    REQUIRE(&first != &other);
+    REQUIRE(first.name() == bsoncxx::stdx::string_view{"database"});
+    REQUIRE(other.name() == bsoncxx::stdx::string_view{"other"});
+    REQUIRE(get_database_calls == 2);
+
+    mongo_client.clear_cached_handles();
+    mongo_client.cached_database("database");
+
+    REQUIRE(get_database_calls == 3);
+}
+
+TEST_CASE("A client caches collection objects by namespace", "[client]") {
+    instance::current();
+
+    client mongo_client{uri{}, test_util::add_test_server_api()};
+
+    collection& users = mongo_client.cached_collection("app", "users");
+
+    REQUIRE(&users == &mongo_client.cached_collection("app", "users"));
+    REQUIRE(&users != &mongo_client.cached_collection("app", "orders"));
+    REQUIRE(&users != &mongo_client.cached_collection("other", "users"));
+    REQUIRE(users.name() == bsoncxx::stdx::string_view{"users"});
+
+    SECTION("changing the concerns of the client renews the cached objects") {
+        read_concern rc;
+        rc.acknowledge_level(read_concern::level::k_majority);
+        mongo_client.read_concern_deprecated(rc);
+
+        collection& fresh = mongo_client.cached_collection("app", "users");
+
+        REQUIRE(&fresh != &users);
+        REQUIRE(&fresh == &mongo_client.cached_collection("app", "users"));
+        REQUIRE(fresh.read_concern().acknowledge_level() == read_concern::level::k_majority);
+
+        // The objects obtained before remain valid with the previous concerns.
+        REQUIRE(users.name() == bsoncxx::stdx::string_view{"users"});
+        REQUIRE(users.read_concern().acknowledge_level() != read_concern::level::k_majority);
+    }
+
+    SECTION("the concerns of the cached objects cannot be changed") {
+        read_concern rc;
+        rc.acknowledge_level(read_concern::level::k_majority);
+
+        REQUIRE_THROWS_AS(users.read_concern(rc), logic_error);
+        REQUIRE_THROWS_AS(mongo_client.cached_database("app").read_concern(rc), logic_error);
+        REQUIRE(users.read_concern().acknowledge_level() != read_concern::level::k_majority);
+
+        collection copy{users};
+        copy.read_concern(rc);
+
+        REQUIRE(copy.read_concern().acknowledge_level() == read_concern::level::k_majority);
+    }
+
+    SECTION("the cached objects cannot be renamed or assigned to") {
+        REQUIRE_THROWS_AS(users.rename("renamed"), logic_error);
+        REQUIRE_THROWS_AS(users = mongo_client["app"]["orders"], logic_error);
+        REQUIRE_THROWS_AS(mongo_client.cached_database("app") = mongo_client["other"], logic_error);
+
+        collection other = mongo_client["app"]["orders"];
+        REQUIRE_THROWS_AS(users = other, logic_error);
+        REQUIRE(users.name() == bsoncxx::stdx::string_view{"users"});
+
+        // Moving from a cached object copies it.
+        other = std::move(users);
+
+        REQUIRE(users);
+        REQUIRE(users.name() == bsoncxx::stdx::string_view{"users"});
+        REQUIRE(other.name() == bsoncxx::stdx::string_view{"users"});
+    }
+
+    SECTION("a moved client keeps its cached objects") {
+        client moved{std::move(mongo_client)};
+
+        REQUIRE(&users == &moved.cached_collection("app", "users"));
+    }
+}
+
 TEST_CASE("integration tests for client metadata handshake feature") {
     using bsoncxx::builder::basic::kvp;
     using bsoncxx::builder::basic::make_document;
@@ -0,0 +1,167 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/test/v_noabi/client_helpers.hh>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+
+#include <mongocxx/client.hpp>
+#include <mongocxx/command_filter.hpp>
+#include <mongocxx/command_metrics.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/apm.hpp>
+#include <mongocxx/options/client.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+using namespace mongocxx;
+
+struct counts {
+    std::uint64_t started = 0;
+    std::uint64_t succeeded = 0;
+    std::uint64_t failed = 0;
+};
+
+options::apm make_apm_opts(std::shared_ptr<command_filter> filter, std::string const& command_name, counts& c) {
+    options::apm apm_opts;
+
+    apm_opts.filter(std::move(filter));
+
+    apm_opts.on_command_started([&c, command_name](events::command_started_event const& event) {
+        if (event.command_name() == command_name) {
+            ++c.started;
+        }
+    });
+
+    apm_opts.on_command_succeeded([&c, command_name](events::command_succeeded_event const& event) {
+        if (event.command_name() == command_name) {
+            ++c.succeeded;
+        }
+    });
+
+    apm_opts.on_command_failed([&c, command_name](events::command_failed_event const& event) {
+        if (event.command_name() == command_name) {
+            ++c.failed;
+        }
+    });
+
+    return apm_opts;
+}
+
+client make_client(options::apm const& apm_opts) {
+    auto client_opts = test_util::add_test_server_api();
+    client_opts.apm_opts(apm_opts);
+
+    return client{uri{}, client_opts};
+}
+
+void ping(client& client, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        client["admin"].run_command(make_document(kvp("ping", 1)));
+    }
+}
+
+TEST_CASE("command_filter options", "[command_filter]") {
+    command_filter filter;
+
+    CHECK_THROWS_AS(filter.sample(0u), logic_error);
+    CHECK(filter.filtered() == 0u);
+
+    options::apm apm_opts;
+
+    CHECK_FALSE(apm_opts.filter());
+
+    auto const shared = std::make_shared<command_filter>();
+    apm_opts.filter(shared);
+
+    CHECK(apm_opts.filter() == shared);
+}
+
+TEST_CASE("command_filter ignores commands", "[command_filter]") {
+    instance::current();
+
+    auto const filter = std::make_shared<command_filter>();
+    filter->ignore_command("ping");
+
+    counts c;
+    auto client = make_client(make_apm_opts(filter, "ping", c));
+
+    ping(client, 3u);
+
+    CHECK(c.started == 0u);
+    CHECK(c.succeeded == 0u);
+    CHECK(filter->filtered() >= 6u);
+}
+
+TEST_CASE("command_filter monitors databases", "[command_filter]") {
+    instance::current();
+
+    auto const metrics = std::make_shared<command_metrics>();
+    auto const filter = std::make_shared<command_filter>();
+    filter->monitor_database("not_admin");
+
+    counts c;
+    auto apm_opts = make_apm_opts(filter, "ping", c);
+    apm_opts.metrics(metrics);
+
+    auto client = make_client(apm_opts);
+
+    ping(client, 3u);
+
+    // The succeeded events follow the decision made for the started events.
+    CHECK(c.started == 0u);
+    CHECK(c.succeeded == 0u);
+
+    // Metrics are recorded regardless of the filter.
+    std::uint64_t recorded = 0;
+
+    for (auto const& s : metrics->snapshot()) {
+        if (s.command_name == "ping") {
+            recorded += s.count;
+        }
+    }
+
+    CHECK(recorded == 3u);
+}
+
+TEST_CASE("command_filter samples commands", "[command_filter]") {
+    instance::current();
+
+    auto const filter = std::make_shared<command_filter>();
+    filter->sample(2u);
+
+    counts c;
+    auto client = make_client(make_apm_opts(filter, "ping", c));
+
+    ping(client, 20u);
+
+    CHECK(c.started < 20u);
+    CHECK(c.started == c.succeeded);
+    CHECK(filter->filtered() > 0u);
+}
+
+} // namespace
@@ -0,0 +1,190 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/test/v_noabi/client_helpers.hh>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+
+#include <mongocxx/client.hpp>
+#include <mongocxx/command_metrics.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/apm.hpp>
+#include <mongocxx/options/client.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+using namespace mongocxx;
+
+std::uint64_t bucket_total(command_metrics::series const& s) {
+    std::uint64_t total = 0;
+
+    for (auto const count : s.buckets) {
+        total += count;
+    }
+
+    return total;
+}
+
+TEST_CASE("command_metrics buckets durations", "[command_metrics]") {
+    auto const& bounds = command_metrics::bucket_bounds();
+
+    REQUIRE(bounds.front() == 50);
+    REQUIRE(bounds.back() == 10000000);
+
+    command_metrics metrics;
+
+    CHECK(metrics.snapshot().empty());
+
+    metrics.record("find", "localhost:27017", 50, false);
+    metrics.record("find", "localhost:27017", 51, false);
+    metrics.record("find", "localhost:27017", -1, true);
+    metrics.record("find", "localhost:27017", 20000000, false);
+
+    auto const all = metrics.snapshot();
+
+    REQUIRE(all.size() == 1u);
+
+    auto const& s = all.front();
+
+    CHECK(s.command_name == "find");
+    CHECK(s.host == "localhost:27017");
+    CHECK(s.count == 4u);
+    CHECK(s.failures == 1u);
+    CHECK(s.sum_microseconds == 20000101u);
+    CHECK(s.buckets[0] == 2u);
+    CHECK(s.buckets[1] == 1u);
+    CHECK(s.buckets[command_metrics::k_bucket_count - 1] == 1u);
+    CHECK(bucket_total(s) == s.count);
+}
+
+TEST_CASE("command_metrics merges the shards of every thread", "[command_metrics]") {
+    command_metrics metrics;
+
+    constexpr int k_threads = 4;
+    constexpr int k_records = 1000;
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < k_threads; ++t) {
+        threads.emplace_back([&metrics, t] {
+            for (int i = 0; i < k_records; ++i) {
+                metrics.record(i % 2 ? "find" : "insert", t % 2 ? "a:27017" : "b:27017", i, i % 10 == 0);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto const all = metrics.snapshot();
+
+    REQUIRE(all.size() == 4u);
+
+    // Ordered by command name and then host.
+    CHECK(all[0].command_name == "find");
+    CHECK(all[0].host == "a:27017");
+    CHECK(all[1].command_name == "find");
+    CHECK(all[1].host == "b:27017");
+    CHECK(all[2].command_name == "insert");
+    CHECK(all[2].host == "a:27017");
+
+    std::uint64_t count = 0;
+    std::uint64_t failures = 0;
+
+    for (auto const& s : all) {
+        CHECK(bucket_total(s) == s.count);
+        count += s.count;
+        failures += s.failures;
+    }
+
+    CHECK(count == std::uint64_t{k_threads * k_records});
+    CHECK(failures == std::uint64_t{k_threads * k_records / 10});
+}
+
+TEST_CASE("command_metrics exports the Prometheus text format", "[command_metrics]") {
+    command_metrics metrics;
+
+    metrics.record("find", "my\"host:27017", 40, false);
+    metrics.record("find", "my\"host:27017", 1500001, true);
+
+    auto const text = metrics.to_prometheus("db");
+
+    CHECK(text.find("# TYPE db_duration_seconds histogram\n") != std::string::npos);
+    CHECK(
+        text.find("db_duration_seconds_bucket{command=\"find\",host=\"my\\\"host:27017\",le=\"0.00005\"} 1\n") !=
+        std::string::npos);
+    CHECK(
+        text.find("db_duration_seconds_bucket{command=\"find\",host=\"my\\\"host:27017\",le=\"2.5\"} 2\n") !=
+        std::string::npos);
+    CHECK(
+        text.find("db_duration_seconds_bucket{command=\"find\",host=\"my\\\"host:27017\",le=\"+Inf\"} 2\n") !=
+        std::string::npos);
+    CHECK(
+        text.find("db_duration_seconds_sum{command=\"find\",host=\"my\\\"host:27017\"} 1.500041\n") !=
+        std::string::npos);
+    CHECK(text.find("db_duration_seconds_count{command=\"find\",host=\"my\\\"host:27017\"} 2\n") != std::string::npos);
+    CHECK(text.find("# TYPE db_failures_total counter\n") != std::string::npos);
+    CHECK(text.find("db_failures_total{command=\"find\",host=\"my\\\"host:27017\"} 1\n") != std::string::npos);
+}
+
+TEST_CASE("command_metrics records the commands of a client", "[command_metrics]") {
+    instance::current();
+
+    auto metrics = std::make_shared<command_metrics>();
+
+    options::apm apm_opts;
+
+    CHECK_FALSE(apm_opts.metrics());
+    apm_opts.metrics(metrics);
+    CHECK(apm_opts.metrics() == metrics);
+
+    auto client_opts = test_util::add_test_server_api();
+    client_opts.apm_opts(apm_opts);
+
+    client client{uri{}, client_opts};
+
+    client["admin"].run_command(make_document(kvp("ping", 1)));
+    CHECK_THROWS(client["admin"].run_command(make_document(kvp("notACommand", 1))));
+
+    bool found_ping = false;
+    bool found_failure = false;
+
+    for (auto const& s : metrics->snapshot()) {
+        if (s.command_name == "ping") {
+            found_ping = s.count == 1u && s.failures == 0u;
+        }
+
+        if (s.command_name == "notACommand") {
+            found_failure = s.count == 1u && s.failures == 1u;
+        }
+    }
+
+    CHECK(found_ping);
+    CHECK(found_failure);
+}
+
+} // namespace
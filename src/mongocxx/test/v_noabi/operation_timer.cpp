@@ -0,0 +1,173 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/test/v_noabi/client_helpers.hh>
+
+#include <chrono>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+
+#include <mongocxx/client.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/operation_timer.hpp>
+#include <mongocxx/options/apm.hpp>
+#include <mongocxx/options/client.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+using namespace mongocxx;
+
+client make_client(bool operation_timing) {
+    options::apm apm_opts;
+    apm_opts.operation_timing(operation_timing);
+
+    auto client_opts = test_util::add_test_server_api();
+    client_opts.apm_opts(apm_opts);
+
+    return client{uri{}, client_opts};
+}
+
+TEST_CASE("operation_timing option", "[operation_timer]") {
+    options::apm apm_opts;
+
+    CHECK_FALSE(apm_opts.operation_timing());
+    apm_opts.operation_timing(true);
+    CHECK(apm_opts.operation_timing());
+}
+
+TEST_CASE("operation_timer breaks down find_one", "[operation_timer]") {
+    instance::current();
+
+    auto client = make_client(true);
+    auto coll = client["operation_timer"]["find_one"];
+
+    coll.drop();
+    coll.insert_one(make_document(kvp("x", 1)));
+
+    operation_timer timer;
+
+    CHECK(timer.phases().commands == 0u);
+
+    auto const doc = coll.find_one(make_document(kvp("x", 1)));
+
+    REQUIRE(doc);
+
+    auto const phases = timer.phases();
+
+    CHECK(phases.commands == 1u);
+    CHECK(phases.prepare > std::chrono::nanoseconds::zero());
+    CHECK(phases.server > std::chrono::nanoseconds::zero());
+    CHECK(phases.results > std::chrono::nanoseconds::zero());
+
+    timer.reset();
+
+    CHECK(timer.phases().commands == 0u);
+    CHECK(timer.phases().prepare == std::chrono::nanoseconds::zero());
+}
+
+TEST_CASE("operation_timer breaks down bulk writes and cursors", "[operation_timer]") {
+    instance::current();
+
+    auto client = make_client(true);
+    auto coll = client["operation_timer"]["bulk_write"];
+
+    coll.drop();
+
+    operation_timer timer;
+
+    auto bulk = coll.create_bulk_write();
+    for (int i = 0; i < 3; ++i) {
+        bulk.append(model::insert_one{make_document(kvp("x", i))});
+    }
+    bulk.execute();
+
+    CHECK(timer.phases().commands == 1u);
+
+    timer.reset();
+
+    int count = 0;
+    for (auto const& doc : coll.find({}, options::find{}.batch_size(1))) {
+        (void)doc;
+        ++count;
+    }
+
+    CHECK(count == 3);
+    CHECK(timer.phases().commands >= 3u);
+    CHECK(timer.phases().server > std::chrono::nanoseconds::zero());
+}
+
+TEST_CASE("operation_timer counts server time as driver time without operation timing", "[operation_timer]") {
+    instance::current();
+
+    auto client = make_client(false);
+    auto coll = client["operation_timer"]["disabled"];
+
+    operation_timer timer;
+
+    coll.find_one({});
+
+    auto const phases = timer.phases();
+
+    CHECK(phases.commands == 0u);
+    CHECK(phases.server == std::chrono::nanoseconds::zero());
+    CHECK(phases.driver > std::chrono::nanoseconds::zero());
+}
+
+TEST_CASE("operation_timer ignores the commands of operations which are not timed", "[operation_timer]") {
+    instance::current();
+
+    auto client = make_client(true);
+    auto coll = client["operation_timer"]["untimed"];
+
+    operation_timer timer;
+
+    client["admin"].run_command(make_document(kvp("ping", 1)));
+    coll.count_documents({});
+
+    auto const phases = timer.phases();
+
+    CHECK(phases.commands == 0u);
+    CHECK(phases.server == std::chrono::nanoseconds::zero());
+}
+
+TEST_CASE("operation_timer records the innermost timer", "[operation_timer]") {
+    instance::current();
+
+    auto client = make_client(true);
+    auto coll = client["operation_timer"]["nested"];
+
+    operation_timer outer;
+
+    {
+        operation_timer inner;
+
+        coll.find_one({});
+
+        CHECK(inner.phases().commands == 1u);
+    }
+
+    CHECK(outer.phases().commands == 0u);
+
+    coll.find_one({});
+
+    CHECK(outer.phases().commands == 1u);
+}
+
+} // namespace
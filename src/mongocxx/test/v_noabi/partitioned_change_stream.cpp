@@ -0,0 +1,226 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/test/v_noabi/client_helpers.hh>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/document/value.hpp>
+
+#include <mongocxx/client.hpp>
+#include <mongocxx/events/command_succeeded_event.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/apm.hpp>
+#include <mongocxx/options/client.hpp>
+#include <mongocxx/options/partitioned_change_stream.hpp>
+#include <mongocxx/partitioned_change_stream.hpp>
+#include <mongocxx/pipeline.hpp>
+#include <mongocxx/pool.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_array;
+using bsoncxx::builder::basic::make_document;
+
+using namespace mongocxx;
+
+void nop_handler(std::size_t, change_stream::batch const&) {}
+
+TEST_CASE("partitioned_change_stream partition filter", "[partitioned_change_stream]") {
+    auto const expected = make_document(kvp(
+        "$or",
+        make_array(
+            make_document(kvp("documentKey", make_document(kvp("$exists", false)))),
+            make_document(kvp(
+                "$expr",
+                make_document(kvp(
+                    "$eq",
+                    make_array(
+                        make_document(kvp(
+                            "$abs",
+                            make_document(kvp(
+                                "$mod",
+                                make_array(
+                                    make_document(kvp("$toHashedIndexKey", "$documentKey._id")),
+                                    std::int64_t{4}))))),
+                        std::int64_t{1}))))))));
+
+    REQUIRE(partitioned_change_stream::partition_filter(1u, 4u) == expected.view());
+}
+
+TEST_CASE("partitioned_change_stream options", "[partitioned_change_stream]") {
+    instance::current();
+    mongocxx::pool pool{uri{}, options::pool(test_util::add_test_server_api())};
+    pipeline pipe;
+
+    SECTION("Defaults to at least one partition") {
+        partitioned_change_stream stream{pool, "streams", "events", pipe, nop_handler};
+        REQUIRE(stream.partitions() >= 1u);
+        REQUIRE(stream.resume_tokens().size() == stream.partitions());
+    }
+
+    SECTION("Zero partitions is an error") {
+        options::partitioned_change_stream opts;
+        opts.partitions(0u);
+        REQUIRE_THROWS_AS((partitioned_change_stream{pool, "streams", "events", pipe, nop_handler, opts}), logic_error);
+    }
+
+    SECTION("Resume tokens must match the number of partitions") {
+        options::partitioned_change_stream opts;
+        opts.partitions(2u);
+        opts.resume_tokens({make_document(kvp("token", 1))});
+        REQUIRE_THROWS_AS((partitioned_change_stream{pool, "streams", "events", pipe, nop_handler, opts}), logic_error);
+    }
+
+    SECTION("Resume tokens are kept until the partitions run") {
+        options::partitioned_change_stream opts;
+        opts.partitions(2u);
+        opts.resume_tokens({make_document(kvp("token", 1)), bsoncxx::stdx::nullopt});
+
+        partitioned_change_stream stream{pool, "streams", "events", pipe, nop_handler, opts};
+        auto const tokens = stream.resume_tokens();
+        REQUIRE(tokens.size() == 2u);
+        REQUIRE(tokens[0]);
+        REQUIRE(tokens[0]->view() == make_document(kvp("token", 1)).view());
+        REQUIRE(!tokens[1]);
+    }
+
+    SECTION("Starting requires a client from the pool for every partition") {
+        mongocxx::pool small_pool{
+            uri{"mongodb://localhost/?maxPoolSize=1"}, options::pool(test_util::add_test_server_api())};
+        options::partitioned_change_stream opts;
+        opts.partitions(2u);
+
+        partitioned_change_stream stream{small_pool, "streams", "events", pipe, nop_handler, opts};
+        REQUIRE_THROWS_AS(stream.start(), logic_error);
+
+        // The clients acquired before the failure are returned to the pool.
+        REQUIRE(small_pool.try_acquire());
+    }
+}
+
+TEST_CASE("partitioned_change_stream delivers every event to exactly one partition", "[partitioned_change_stream]") {
+    instance::current();
+
+    if (!test_util::is_replica_set()) {
+        SKIP("change streams require replica set");
+    }
+
+    if (test_util::compare_versions(test_util::get_server_version(), "7.0") < 0) {
+        SKIP("the partition filter requires $toHashedIndexKey, available in 7.0+");
+    }
+
+    // Signaled once the change stream of every partition is open.
+    std::mutex opened_mutex;
+    std::condition_variable opened_cv;
+    std::size_t opened = 0u;
+
+    options::apm apm_opts;
+    apm_opts.on_command_succeeded([&](events::command_succeeded_event const& event) {
+        if (event.command_name() == "aggregate") {
+            std::lock_guard<std::mutex> lock{opened_mutex};
+            ++opened;
+            opened_cv.notify_all();
+        }
+    });
+
+    auto client_opts = test_util::add_test_server_api();
+    client_opts.apm_opts(apm_opts);
+
+    mongocxx::pool pool{uri{}, options::pool(client_opts)};
+
+    auto client = pool.acquire();
+    auto coll = (*client)["streams"]["partitioned"];
+    coll.drop();
+    coll = (*client)["streams"].create_collection("partitioned");
+
+    constexpr std::size_t partitions = 4u;
+    constexpr int n_events = 32;
+
+    std::mutex mutex;
+    std::vector<std::set<std::int32_t>> seen(partitions);
+    std::atomic<int> count{0};
+
+    options::change_stream cs_opts;
+    cs_opts.max_await_time(std::chrono::milliseconds{100});
+
+    options::partitioned_change_stream opts;
+    opts.partitions(partitions).change_stream_opts(cs_opts);
+
+    pipeline pipe;
+    pipe.match(make_document(kvp("operationType", "insert")));
+
+    partitioned_change_stream stream{
+        pool,
+        "streams",
+        "partitioned",
+        pipe,
+        [&](std::size_t partition, change_stream::batch const& batch) {
+            std::lock_guard<std::mutex> lock{mutex};
+            for (auto const& event : batch) {
+                seen[partition].insert(event["documentKey"]["_id"].get_int32().value);
+                ++count;
+            }
+        },
+        opts};
+
+    stream.start();
+
+    // Only insert once every partition has opened its change stream.
+    {
+        std::unique_lock<std::mutex> lock{opened_mutex};
+        REQUIRE(opened_cv.wait_for(lock, std::chrono::seconds{30}, [&] { return opened >= partitions; }));
+    }
+
+    for (std::int32_t i = 0; i < n_events; ++i) {
+        coll.insert_one(make_document(kvp("_id", i)));
+    }
+
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{30};
+    while (count.load() < n_events && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    }
+
+    stream.stop();
+
+    REQUIRE(count.load() == n_events);
+
+    std::set<std::int32_t> all;
+    for (auto const& ids : seen) {
+        for (auto const id : ids) {
+            REQUIRE(all.insert(id).second);
+        }
+    }
+    REQUIRE(all.size() == static_cast<std::size_t>(n_events));
+
+    for (auto const& token : stream.resume_tokens()) {
+        REQUIRE(token);
+    }
+}
+
+} // namespace
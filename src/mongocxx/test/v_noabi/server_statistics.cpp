@@ -0,0 +1,104 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/test/v_noabi/client_helpers.hh>
+
+#include <memory>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+
+#include <mongocxx/client.hpp>
+#include <mongocxx/command_filter.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/apm.hpp>
+#include <mongocxx/options/client.hpp>
+#include <mongocxx/server_statistics.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+using namespace mongocxx;
+
+TEST_CASE("server_statistics options", "[server_statistics]") {
+    auto const stats = std::make_shared<server_statistics>();
+
+    CHECK(stats->servers().empty());
+    CHECK_FALSE(stats->find("localhost", 27017));
+
+    options::apm apm_opts;
+
+    CHECK_FALSE(apm_opts.server_stats());
+    apm_opts.server_stats(stats);
+    CHECK(apm_opts.server_stats() == stats);
+}
+
+TEST_CASE("server_statistics records the commands of each server", "[server_statistics]") {
+    instance::current();
+
+    auto const stats = std::make_shared<server_statistics>();
+    auto const filter = std::make_shared<command_filter>();
+    filter->ignore_command("ping");
+
+    options::apm apm_opts;
+    apm_opts.server_stats(stats).filter(filter);
+
+    auto client_opts = test_util::add_test_server_api();
+    client_opts.apm_opts(apm_opts);
+
+    client client{uri{}, client_opts};
+
+    for (int i = 0; i < 3; ++i) {
+        client["admin"].run_command(make_document(kvp("ping", 1)));
+    }
+
+    CHECK_THROWS(client["admin"].run_command(make_document(kvp("notACommand", 1))));
+
+    auto const servers = stats->servers();
+
+    REQUIRE_FALSE(servers.empty());
+
+    std::uint64_t succeeded = 0u;
+    std::uint64_t failed = 0u;
+
+    for (auto const& server : servers) {
+        CHECK_FALSE(server.host.empty());
+        CHECK(server.commands_in_flight == 0);
+        CHECK(server.command_durations.samples == server.commands_succeeded + server.commands_failed);
+        CHECK(server.command_durations.p50 <= server.command_durations.p99);
+
+        if (server.commands_succeeded + server.commands_failed > 0u) {
+            CHECK(server.bytes_sent > 0u);
+            CHECK(server.bytes_received > 0u);
+        }
+
+        auto const found = stats->find(server.host, server.port);
+
+        REQUIRE(found);
+        CHECK(found->host == server.host);
+
+        succeeded += server.commands_succeeded;
+        failed += server.commands_failed;
+    }
+
+    // The filter does not apply to the statistics.
+    CHECK(succeeded >= 3u);
+    CHECK(failed >= 1u);
+}
+
+} // namespace
@@ -0,0 +1,166 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/test/v_noabi/client_helpers.hh>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/types.hpp>
+
+#include <mongocxx/client.hpp>
+#include <mongocxx/command_filter.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/apm.hpp>
+#include <mongocxx/options/client.hpp>
+#include <mongocxx/slow_command_log.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+using namespace mongocxx;
+
+client make_client(options::apm const& apm_opts) {
+    auto client_opts = test_util::add_test_server_api();
+    client_opts.apm_opts(apm_opts);
+
+    return client{uri{}, client_opts};
+}
+
+TEST_CASE("slow_command_log options", "[slow_command_log]") {
+    using std::chrono::microseconds;
+    using std::chrono::seconds;
+
+    CHECK_THROWS_AS(slow_command_log(microseconds{-1}), logic_error);
+    CHECK_THROWS_AS(slow_command_log(microseconds{0}, 0u), logic_error);
+    CHECK_THROWS_AS(slow_command_log(microseconds{0}, 1u, seconds{0}), logic_error);
+
+    auto const log = std::make_shared<slow_command_log>(microseconds{100});
+
+    CHECK(log->threshold() == microseconds{100});
+    CHECK(log->slow_count() == 0u);
+    CHECK(log->slowest().empty());
+    CHECK(log->previous_slowest().empty());
+
+    options::apm apm_opts;
+
+    CHECK_FALSE(apm_opts.slow_log());
+    apm_opts.slow_log(log);
+    CHECK(apm_opts.slow_log() == log);
+}
+
+TEST_CASE("slow_command_log records the shape of slow commands", "[slow_command_log]") {
+    instance::current();
+
+    auto const log = std::make_shared<slow_command_log>(std::chrono::microseconds{0});
+
+    options::apm apm_opts;
+    apm_opts.slow_log(log);
+
+    auto client = make_client(apm_opts);
+    auto coll = client["slow_command_log"]["shapes"];
+
+    coll.drop();
+    log->clear();
+
+    coll.find_one(make_document(kvp("age", make_document(kvp("$gt", 30))), kvp("name", "secret")));
+
+    auto const entries = log->slowest();
+
+    REQUIRE(entries.size() == 1u);
+
+    auto const& e = entries[0];
+
+    CHECK(e.command_name == "find");
+    CHECK(e.database_name == "slow_command_log");
+    CHECK(e.collection_name == "shapes");
+    CHECK_FALSE(e.host.empty());
+    CHECK_FALSE(e.failed);
+    CHECK(e.reply_size > 0u);
+    CHECK(log->slow_count() == 1u);
+
+    auto const shape = e.shape.view();
+
+    CHECK(shape["find"].get_string().value == "string");
+    CHECK(
+        shape["filter"].get_document().value ==
+        make_document(kvp("age", make_document(kvp("$gt", "int32"))), kvp("name", "string")));
+    CHECK_FALSE(shape["lsid"]);
+    CHECK_FALSE(shape["$db"]);
+}
+
+TEST_CASE("slow_command_log keeps the slowest commands", "[slow_command_log]") {
+    instance::current();
+
+    auto const log = std::make_shared<slow_command_log>(std::chrono::microseconds{0}, 2u);
+
+    options::apm apm_opts;
+    apm_opts.slow_log(log);
+
+    auto client = make_client(apm_opts);
+
+    for (int i = 0; i < 5; ++i) {
+        client["admin"].run_command(make_document(kvp("ping", 1)));
+    }
+
+    CHECK_THROWS(client["admin"].run_command(make_document(kvp("notACommand", 1))));
+
+    auto const entries = log->slowest();
+
+    REQUIRE(entries.size() == 2u);
+    CHECK(entries[0].duration >= entries[1].duration);
+    CHECK(log->slow_count() >= 6u);
+
+    log->clear();
+
+    CHECK(log->slowest().empty());
+    CHECK(log->slow_count() == 0u);
+}
+
+TEST_CASE("slow_command_log ignores fast commands and the filter", "[slow_command_log]") {
+    instance::current();
+
+    auto const log = std::make_shared<slow_command_log>(std::chrono::hours{1});
+    auto const filter = std::make_shared<command_filter>();
+    filter->ignore_command("ping");
+
+    options::apm apm_opts;
+    apm_opts.slow_log(log).filter(filter);
+
+    auto client = make_client(apm_opts);
+
+    client["admin"].run_command(make_document(kvp("ping", 1)));
+
+    CHECK(log->slowest().empty());
+    CHECK(log->slow_count() == 0u);
+
+    auto const all = std::make_shared<slow_command_log>(std::chrono::microseconds{0});
+    apm_opts.slow_log(all);
+
+    auto other = make_client(apm_opts);
+
+    other["admin"].run_command(make_document(kvp("ping", 1)));
+
+    CHECK(all->slow_count() >= 1u);
+}
+
+} // namespace
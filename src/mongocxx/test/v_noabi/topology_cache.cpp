@@ -0,0 +1,158 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/test/v_noabi/client_helpers.hh>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+
+#include <mongocxx/client.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/apm.hpp>
+#include <mongocxx/options/client.hpp>
+#include <mongocxx/topology_cache.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_array;
+using bsoncxx::builder::basic::make_document;
+
+using namespace mongocxx;
+
+TEST_CASE("topology_cache options", "[topology_cache]") {
+    auto const cache = std::make_shared<topology_cache>();
+
+    {
+        auto const snapshot = cache->current();
+
+        CHECK(snapshot.version() == 0u);
+        CHECK(snapshot.type() == "Unknown");
+        CHECK_FALSE(snapshot.has_writable_server());
+        CHECK(snapshot.servers().empty());
+        CHECK(snapshot.find("localhost", 27017) == nullptr);
+    }
+
+    options::apm apm_opts;
+
+    CHECK_FALSE(apm_opts.cached_topology());
+    apm_opts.cached_topology(cache);
+    CHECK(apm_opts.cached_topology() == cache);
+}
+
+TEST_CASE("topology_cache follows the topology of a client", "[topology_cache]") {
+    instance::current();
+
+    auto const cache = std::make_shared<topology_cache>();
+    auto const initial = cache->current();
+
+    options::apm apm_opts;
+    apm_opts.cached_topology(cache);
+
+    {
+        auto client_opts = test_util::add_test_server_api();
+        client_opts.apm_opts(apm_opts);
+
+        client client{uri{}, client_opts};
+
+        client["admin"].run_command(make_document(kvp("ping", 1)));
+
+        auto const snapshot = cache->current();
+
+        CHECK(snapshot.version() > 0u);
+        CHECK(snapshot.type() != "Unknown");
+        CHECK(snapshot.has_writable_server());
+        REQUIRE_FALSE(snapshot.servers().empty());
+
+        for (auto const& server : snapshot.servers()) {
+            CHECK_FALSE(server.host.empty());
+            CHECK(snapshot.find(server.host, server.port) == &server);
+        }
+
+        // A snapshot is unaffected by later changes.
+        CHECK(initial.version() == 0u);
+        CHECK(initial.servers().empty());
+    }
+
+    // Destroying the client closes the topology.
+    auto const closed = cache->current();
+
+    CHECK(closed.type() == "Unknown");
+    CHECK(closed.servers().empty());
+}
+
+TEST_CASE("topology_cache keeps round-trip times in microseconds", "[topology_cache]") {
+    instance::current();
+
+    client setup_client{uri{}, test_util::add_test_server_api()};
+
+    if (test_util::get_topology() != "single") {
+        SKIP("the round-trip time is only delayed for the server the fail point is set on");
+    }
+
+    if (test_util::compare_versions(test_util::get_server_version(), "4.4") < 0) {
+        SKIP("failCommand with blockConnection on hello requires 4.4+");
+    }
+
+    // Every hello of the client takes at least 100 milliseconds.
+    setup_client["admin"].run_command(make_document(
+        kvp("configureFailPoint", "failCommand"),
+        kvp("mode", "alwaysOn"),
+        kvp("data",
+            make_document(
+                kvp("failCommands", make_array("hello", "isMaster")),
+                kvp("blockConnection", true),
+                kvp("blockTimeMS", 100),
+                kvp("appName", "topology_cache_rtt")))));
+
+    auto const cache = std::make_shared<topology_cache>();
+
+    {
+        options::apm apm_opts;
+        apm_opts.cached_topology(cache);
+
+        auto client_opts = test_util::add_test_server_api();
+        client_opts.apm_opts(apm_opts);
+
+        client client{uri{"mongodb://localhost/?appName=topology_cache_rtt&heartbeatFrequencyMS=500"}, client_opts};
+
+        client["admin"].run_command(make_document(kvp("ping", 1)));
+
+        // Let the next server selection check the server again.
+        std::this_thread::sleep_for(std::chrono::milliseconds{600});
+
+        client["admin"].run_command(make_document(kvp("ping", 1)));
+
+        // Both the round-trip time of the topology change and the durations of the heartbeats
+        // folded into it are at least 100 milliseconds.
+        auto const snapshot = cache->current();
+
+        REQUIRE_FALSE(snapshot.servers().empty());
+
+        for (auto const& server : snapshot.servers()) {
+            CHECK(server.round_trip_time >= 50000);
+        }
+    }
+
+    setup_client["admin"].run_command(make_document(kvp("configureFailPoint", "failCommand"), kvp("mode", "off")));
+}
+
+} // namespace
@@ -0,0 +1,179 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/test/v_noabi/client_helpers.hh>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/json.hpp>
+#include <bsoncxx/types.hpp>
+#include <bsoncxx/types/bson_value/view.hpp>
+
+#include <mongocxx/client.hpp>
+#include <mongocxx/exception/logic_error.hpp>
+#include <mongocxx/instance.hpp>
+#include <mongocxx/options/apm.hpp>
+#include <mongocxx/options/client.hpp>
+#include <mongocxx/tracing/file_exporter.hpp>
+#include <mongocxx/tracing/memory_exporter.hpp>
+#include <mongocxx/tracing/tracer.hpp>
+
+#include <bsoncxx/test/catch.hh>
+
+namespace {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_document;
+
+using namespace mongocxx;
+
+client make_client(std::shared_ptr<tracing::tracer> tracer) {
+    options::apm apm_opts;
+    apm_opts.tracer(std::move(tracer));
+
+    auto client_opts = test_util::add_test_server_api();
+    client_opts.apm_opts(apm_opts);
+
+    return client{uri{}, client_opts};
+}
+
+TEST_CASE("tracing options", "[tracing]") {
+    CHECK_THROWS_AS(tracing::tracer{nullptr}, logic_error);
+    CHECK_THROWS_AS(tracing::memory_exporter{0u}, logic_error);
+
+    auto const exporter = std::make_shared<tracing::memory_exporter>();
+    auto const tracer = std::make_shared<tracing::tracer>(exporter);
+
+    CHECK(tracer->exporter() == exporter);
+
+    options::apm apm_opts;
+
+    CHECK_FALSE(apm_opts.tracer());
+    apm_opts.tracer(tracer);
+    CHECK(apm_opts.tracer() == tracer);
+}
+
+TEST_CASE("tracer pairs command events into spans", "[tracing]") {
+    instance::current();
+
+    auto const exporter = std::make_shared<tracing::memory_exporter>();
+    auto client = make_client(std::make_shared<tracing::tracer>(exporter));
+
+    auto coll = client["tracing"]["spans"];
+    coll.drop();
+    coll.insert_one(make_document(kvp("x", 1)));
+    coll.find_one(make_document(kvp("x", 1)));
+    CHECK_THROWS(client["admin"].run_command(make_document(kvp("notACommand", 1))));
+
+    auto const spans = exporter->spans();
+
+    tracing::span const* insert = nullptr;
+    tracing::span const* find = nullptr;
+    tracing::span const* failed = nullptr;
+
+    for (auto const& s : spans) {
+        if (s.command_name == "insert") {
+            insert = &s;
+        } else if (s.command_name == "find") {
+            find = &s;
+        } else if (s.command_name == "notACommand") {
+            failed = &s;
+        }
+    }
+
+    REQUIRE(insert);
+    CHECK(insert->database_name == "tracing");
+    CHECK(insert->collection_name == "spans");
+    CHECK_FALSE(insert->failed);
+    CHECK(insert->attempt == 1u);
+    CHECK(insert->duration.count() >= 0);
+    CHECK_FALSE(insert->host.empty());
+
+    REQUIRE(find);
+    CHECK(find->collection_name == "spans");
+    CHECK(find->request_id != insert->request_id);
+    CHECK(find->operation_id != insert->operation_id);
+
+    REQUIRE(failed);
+    CHECK(failed->failed);
+    CHECK(failed->database_name == "admin");
+    CHECK(failed->collection_name.empty());
+    CHECK_FALSE(failed->error_message.empty());
+}
+
+TEST_CASE("memory_exporter keeps the most recent spans", "[tracing]") {
+    instance::current();
+
+    auto const exporter = std::make_shared<tracing::memory_exporter>(2u);
+    auto client = make_client(std::make_shared<tracing::tracer>(exporter));
+
+    for (int i = 0; i < 5; ++i) {
+        client["admin"].run_command(make_document(kvp("ping", 1)));
+    }
+
+    auto const spans = exporter->spans();
+
+    REQUIRE(spans.size() == 2u);
+    CHECK(spans[0].request_id < spans[1].request_id);
+
+    exporter->clear();
+
+    CHECK(exporter->spans().empty());
+}
+
+TEST_CASE("file_exporter writes one JSON document per span", "[tracing]") {
+    instance::current();
+
+    std::string const path = "mongocxx-test-tracing.jsonl";
+    std::remove(path.c_str());
+
+    {
+        auto const exporter = std::make_shared<tracing::file_exporter>(path);
+        auto client = make_client(std::make_shared<tracing::tracer>(exporter));
+
+        client["admin"].run_command(make_document(kvp("ping", 1)));
+        client["admin"].run_command(make_document(kvp("ping", 1)));
+
+        exporter->flush();
+    }
+
+    std::ifstream file{path};
+    std::vector<bsoncxx::document::value> lines;
+
+    for (std::string line; std::getline(file, line);) {
+        lines.push_back(bsoncxx::from_json(line));
+    }
+
+    REQUIRE(lines.size() == 2u);
+
+    auto const first = lines[0].view();
+
+    CHECK(first["command_name"].get_string().value == "ping");
+    CHECK(first["database_name"].get_string().value == "admin");
+    // Relaxed extended JSON does not preserve the width of integers.
+    CHECK(first["attempt"].get_value() == bsoncxx::types::bson_value::view{bsoncxx::types::b_int32{1}});
+    CHECK(first["failed"].get_bool().value == false);
+    CHECK(first["start_time"]);
+    CHECK(first["duration_us"]);
+
+    std::remove(path.c_str());
+}
+
+} // namespace